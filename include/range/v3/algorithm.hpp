@@ -58,6 +58,7 @@
 #include <range/v3/algorithm/partition_move.hpp>
 #include <range/v3/algorithm/partition_point.hpp>
 #include <range/v3/algorithm/permutation.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
 #include <range/v3/algorithm/random_shuffle.hpp>
 #include <range/v3/algorithm/remove.hpp>
 #include <range/v3/algorithm/remove_copy.hpp>
@@ -89,6 +90,7 @@
 #include <range/v3/algorithm/aux_/lower_bound_n.hpp>
 #include <range/v3/algorithm/aux_/merge_n.hpp>
 #include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
+#include <range/v3/algorithm/aux_/radix_sort_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/sort_n_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/upper_bound_n.hpp>
 
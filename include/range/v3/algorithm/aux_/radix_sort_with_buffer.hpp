@@ -0,0 +1,186 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_RADIX_SORT_WITH_BUFFER_HPP
+#define RANGES_V3_ALGORITHM_AUX_RADIX_SORT_WITH_BUFFER_HPP
+
+#include <limits>
+#include <algorithm>
+#include <memory>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Maps a key onto an unsigned integer with the same ordering, so that
+            // keys can be sorted one byte at a time.
+            template<typename K, typename Enable = void>
+            struct radix_key
+              : std::false_type
+            {};
+
+            template<>
+            struct radix_key<bool>
+              : std::true_type
+            {
+                using bits_t = unsigned char;
+                static bits_t bits(bool k)
+                {
+                    return k ? 1 : 0;
+                }
+            };
+
+            template<typename K>
+            struct radix_key<K, enable_if_t<std::is_integral<K>::value &&
+                !std::is_same<K, bool>::value, void>>
+              : std::true_type
+            {
+                using bits_t = typename std::make_unsigned<K>::type;
+                static bits_t bits(K k)
+                {
+                    // Flipping the sign bit orders negative values before positive ones.
+                    return std::is_signed<K>::value ?
+                        bits_t(bits_t(k) ^ (bits_t(1) << (sizeof(K) * CHAR_BIT - 1))) :
+                        bits_t(k);
+                }
+            };
+
+            // IEEE 754 single and double precision. Negative values have all their
+            // bits flipped and positive ones their sign bit set, which orders
+            // -inf < ... < -0.0 < +0.0 < ... < +inf, with NaNs at the extremes
+            // according to their sign.
+            template<typename K>
+            struct radix_key<K, enable_if_t<std::is_floating_point<K>::value &&
+                std::numeric_limits<K>::is_iec559 && (sizeof(K) == 4 || sizeof(K) == 8), void>>
+              : std::true_type
+            {
+                using bits_t = meta::if_c<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+                static bits_t bits(K k)
+                {
+                    bits_t b;
+                    std::memcpy(&b, &k, sizeof(K));
+                    bits_t const sign = bits_t(1) << (sizeof(K) * CHAR_BIT - 1);
+                    return (b & sign) ? bits_t(~b) : bits_t(b | sign);
+                }
+            };
+
+            template<typename I, typename P>
+            using radix_key_t = radix_key<concepts::Readable::value_t<Project<I, P>>>;
+
+            // Moves each element of [begin, end) to its slot in out, as given by the
+            // running offset of its digit.
+            template<typename Key, typename I, typename O, typename D, typename P>
+            void radix_scatter(I begin, I end, O out, D *offsets, std::size_t shift, P &proj)
+            {
+                for(; begin != end; ++begin)
+                    *(out + offsets[(Key::bits(proj(*begin)) >> shift) & 0xff]++) =
+                        iter_move(begin);
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-concepts
+        /// @{
+        template<typename I, typename P = ident>
+        using RadixSortable = meta::fast_and<
+            RandomAccessIterator<I>,
+            Permutable<I>,
+            detail::radix_key_t<I, P>>;
+        /// @}
+
+        namespace aux
+        {
+            // Stable least-significant-digit radix sort, one byte per pass. buffer
+            // points to raw memory for at least end - begin objects; it is restored to
+            // raw memory on return.
+            struct radix_sort_with_buffer_fn
+            {
+                template<typename I, typename V, typename P = ident,
+                    CONCEPT_REQUIRES_(RadixSortable<I, P>())>
+                void operator()(I begin, I end, V *buffer, P proj_ = P{}) const
+                {
+                    using Key = detail::radix_key_t<I, P>;
+                    using bits_t = typename Key::bits_t;
+                    using D = iterator_difference_t<I>;
+                    static constexpr std::size_t passes = sizeof(bits_t);
+                    auto &&proj = invokable(proj_);
+                    D const len = end - begin;
+                    if(len < 2)
+                        return;
+
+                    // Count every digit of every key in a single sweep.
+                    D counts[passes][256] = {};
+                    for(I i = begin; i != end; ++i)
+                    {
+                        bits_t const b = Key::bits(proj(*i));
+                        for(std::size_t p = 0; p < passes; ++p)
+                            ++counts[p][(b >> (p * CHAR_BIT)) & 0xff];
+                    }
+
+                    // Move everything into the buffer, keeping track of how many objects
+                    // need destroying, then ping-pong between the buffer and the range.
+                    V *buffer_end = buffer + len;
+                    std::unique_ptr<V, detail::destroy_n<V>> h{buffer, {}};
+                    ranges::move(begin, end,
+                        ranges::make_counted_raw_storage_iterator(buffer, h.get_deleter()));
+                    bool in_buffer = true;
+                    for(std::size_t p = 0; p < passes; ++p)
+                    {
+                        D *offsets = counts[p];
+                        // A digit shared by every key leaves the order unchanged.
+                        if(std::find(offsets, offsets + 256, len) != offsets + 256)
+                            continue;
+                        for(D d = 0, sum = 0; d < 256; ++d)
+                        {
+                            D const count = offsets[d];
+                            offsets[d] = sum;
+                            sum += count;
+                        }
+                        if(in_buffer)
+                            detail::radix_scatter<Key>(buffer, buffer_end, begin, offsets,
+                                p * CHAR_BIT, proj);
+                        else
+                            detail::radix_scatter<Key>(begin, end, buffer, offsets,
+                                p * CHAR_BIT, proj);
+                        in_buffer = !in_buffer;
+                    }
+                    if(in_buffer)
+                        ranges::move(buffer, buffer_end, begin);
+                }
+            };
+
+            namespace
+            {
+                constexpr auto&& radix_sort_with_buffer =
+                    static_const<radix_sort_with_buffer_fn>::value;
+            }
+        } // namespace aux
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
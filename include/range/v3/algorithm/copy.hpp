@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COPY_HPP
 #define RANGES_V3_ALGORITHM_COPY_HPP
 
+#include <cstring>
 #include <utility>
 #include <functional>
 #include <range/v3/range_fwd.hpp>
@@ -24,6 +25,10 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/copy.hpp>
+#include <range/v3/for_each_block.hpp>
+#include <range/v3/for_each_while.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/segmented.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -34,6 +39,100 @@ namespace ranges
         /// @{
         struct copy_fn : aux::copy_fn
         {
+        private:
+            template<typename I, typename S, typename O, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, P proj_, std::false_type)
+            {
+                auto &&proj = invokable(proj_);
+                for(; begin != end; ++begin, ++out)
+                    *out = proj(*begin);
+                return {begin, out};
+            }
+            // Contiguous ranges of trivially copyable objects are copied with memmove.
+            template<typename I, typename S, typename O, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, P, std::true_type)
+            {
+                auto const n = end - begin;
+                if(n > 0)
+                    std::memmove(detail::contiguous_data(out), detail::contiguous_data(begin),
+                        static_cast<std::size_t>(n) * sizeof(detail::contiguous_value_t<I>));
+                return {begin + n, out + n};
+            }
+            template<typename O, typename P>
+            struct segment_fn
+            {
+                O &out_;
+                P &proj_;
+                template<typename I, typename S>
+                bool operator()(I &begin, S end) const
+                {
+                    auto res = copy_fn{}(std::move(begin), std::move(end), std::move(out_), proj_);
+                    begin = std::move(res.first);
+                    out_ = std::move(res.second);
+                    return false;
+                }
+            };
+            template<typename O, typename P>
+            struct push_fn
+            {
+                O &out_;
+                P &proj_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    *out_ = invokable(proj_)(std::forward<T>(t));
+                    ++out_;
+                    return true;
+                }
+            };
+            template<typename O>
+            struct block_fn
+            {
+                O &out_;
+                template<typename T>
+                void operator()(T const *p, std::ptrdiff_t n) const
+                {
+                    for(std::ptrdiff_t i = 0; i < n; ++i, ++out_)
+                        *out_ = p[i];
+                }
+            };
+            template<typename Rng, typename O, typename P>
+            static std::pair<range_iterator_t<Rng>, O>
+            impl(Rng &rng, O out, P proj, meta::size_t<0>)
+            {
+                return copy_fn{}(begin(rng), end(rng), std::move(out), std::move(proj));
+            }
+            // Segmented ranges are copied one inner range at a time, so each one
+            // gets the memmove path above when it qualifies.
+            template<typename Rng, typename O, typename P>
+            static std::pair<range_iterator_t<Rng>, O>
+            impl(Rng &rng, O out, P proj, meta::size_t<2>)
+            {
+                segment_fn<O, P> seg{out, proj};
+                auto it = detail::for_each_segment(rng, seg);
+                return {std::move(it), std::move(out)};
+            }
+            // Other views that drive their own loop push each element to the output.
+            template<typename Rng, typename O, typename P>
+            static std::pair<range_iterator_t<Rng>, O>
+            impl(Rng &rng, O out, P proj, meta::size_t<1>)
+            {
+                push_fn<O, P> push{out, proj};
+                auto it = ranges::for_each_while(rng, push);
+                return {std::move(it), std::move(out)};
+            }
+            // Bounded pipelines with a filter in them are copied one block at a
+            // time.
+            template<typename Rng, typename O>
+            static std::pair<range_iterator_t<Rng>, O>
+            impl(Rng &rng, O out, ident, meta::size_t<3>)
+            {
+                block_fn<O> block{out};
+                ranges::for_each_block(rng, block);
+                return {end(rng), std::move(out)};
+            }
+
+        public:
             using aux::copy_fn::operator();
 
             template<typename I, typename S, typename O, typename P = ident,
@@ -43,12 +142,10 @@ namespace ranges
                     IndirectlyCopyable<I, O, P>()
                 )>
             std::pair<I, O>
-            operator()(I begin, S end, O out, P proj_ = P{}) const
+            operator()(I begin, S end, O out, P proj = P{}) const
             {
-                auto &&proj = invokable(proj_);
-                for(; begin != end; ++begin, ++out)
-                    *out = proj(*begin);
-                return {begin, out};
+                return copy_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    std::move(proj), detail::memmove_copyable<I, S, O, P>{});
             }
 
             template<typename Rng, typename O, typename P = ident,
@@ -61,7 +158,11 @@ namespace ranges
             std::pair<I, O>
             operator()(Rng &rng, O out, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out), std::move(proj));
+                return copy_fn::impl(rng, std::move(out), std::move(proj),
+                    meta::size_t<detail::use_blocks<Rng>::value &&
+                        BoundedIterable<Rng>() && Same<P, ident>() ? 3 :
+                        detail::is_segmented<Rng>::value ? 2 :
+                        detail::is_pushable<Rng>::value ? 1 : 0>{});
             }
         };
 
@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COPY_BACKWARD_HPP
 #define RANGES_V3_ALGORITHM_COPY_BACKWARD_HPP
 
+#include <cstring>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -21,6 +22,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -31,19 +33,37 @@ namespace ranges
         /// @{
         struct copy_backward_fn
         {
+        private:
+            template<typename I, typename S, typename O, typename P>
+            static std::pair<I, O> impl(I begin, S end_, O out, P proj, std::false_type)
+            {
+                auto &&iproj = invokable(proj);
+                I i = next_to(begin, end_), end = i;
+                while(begin != i)
+                    *--out = iproj(*--i);
+                return {end, out};
+            }
+            template<typename I, typename S, typename O, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, P, std::true_type)
+            {
+                auto const n = end - begin;
+                if(n > 0)
+                    std::memmove(detail::contiguous_data(out - n), detail::contiguous_data(begin),
+                        static_cast<std::size_t>(n) * sizeof(detail::contiguous_value_t<I>));
+                return {begin + n, out - n};
+            }
+
+        public:
             template<typename I, typename S, typename O, typename P = ident,
                 CONCEPT_REQUIRES_(
                     BidirectionalIterator<I>() && IteratorRange<I, S>() &&
                     BidirectionalIterator<O>() &&
                     IndirectlyCopyable<I, O, P>()
                 )>
-            std::pair<I, O> operator()(I begin, S end_, O out, P proj = P{}) const
+            std::pair<I, O> operator()(I begin, S end, O out, P proj = P{}) const
             {
-                auto &&iproj = invokable(proj);
-                I i = next_to(begin, end_), end = i;
-                while(begin != i)
-                    *--out = iproj(*--i);
-                return {end, out};
+                return copy_backward_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    std::move(proj), detail::memmove_copyable<I, S, O, P>{});
             }
 
             template<typename Rng, typename O, typename P = ident,
@@ -14,14 +14,18 @@
 #define RANGES_V3_ALGORITHM_COUNT_HPP
 
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/segmented.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -32,11 +36,10 @@ namespace ranges
         /// @{
         struct count_fn
         {
-            template<typename I, typename S, typename V, typename P = ident,
-                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
-                    IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
-            iterator_difference_t<I>
-            operator()(I begin, S end, V const & val, P proj_ = P{}) const
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I>
+            impl(I begin, S end, V const & val, P proj_, std::false_type)
             {
                 auto &&proj = invokable(proj_);
                 iterator_difference_t<I> n = 0;
@@ -45,6 +48,61 @@ namespace ranges
                         ++n;
                 return n;
             }
+#if RANGES_HAVE_X86_SIMD
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I>
+            impl(I begin, S end, V const & val, P, std::true_type)
+            {
+                using E = detail::contiguous_value_t<I>;
+                auto const n = end - begin;
+                // No element compares equal to a value that E can't represent.
+                E const e = static_cast<E>(val);
+                if(n <= 0 || !detail::same_value(e, val))
+                    return 0;
+                return static_cast<iterator_difference_t<I>>(detail::simd::count(
+                    detail::contiguous_data(begin), static_cast<std::size_t>(n), e));
+            }
+#endif
+            template<typename D, typename V, typename P>
+            struct segment_fn
+            {
+                D &n_;
+                V const &val_;
+                P &proj_;
+                template<typename I, typename S>
+                bool operator()(I &begin, S end) const
+                {
+                    n_ += count_fn{}(begin, end, val_, proj_);
+                    ranges::advance_to(begin, end);
+                    return false;
+                }
+            };
+            template<typename Rng, typename V, typename P>
+            static range_difference_t<Rng> impl(Rng &rng, V const &val, P proj, std::false_type)
+            {
+                return count_fn{}(begin(rng), end(rng), val, std::move(proj));
+            }
+            // Segmented ranges are counted one inner range at a time, so each one
+            // gets the simd path above when it qualifies.
+            template<typename Rng, typename V, typename P>
+            static range_difference_t<Rng> impl(Rng &rng, V const &val, P proj, std::true_type)
+            {
+                range_difference_t<Rng> n = 0;
+                segment_fn<range_difference_t<Rng>, V, P> seg{n, val, proj};
+                detail::for_each_segment(rng, seg);
+                return n;
+            }
+
+        public:
+            template<typename I, typename S, typename V, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
+            iterator_difference_t<I>
+            operator()(I begin, S end, V const & val, P proj = P{}) const
+            {
+                return count_fn::impl(std::move(begin), std::move(end), val, std::move(proj),
+                    detail::simd_countable<I, S, V, P>{});
+            }
 
             template<typename Rng, typename V, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -53,7 +111,7 @@ namespace ranges
             iterator_difference_t<I>
             operator()(Rng &&rng, V const & val, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), val, std::move(proj));
+                return count_fn::impl(rng, val, std::move(proj), detail::is_segmented<Rng>{});
             }
         };
 
@@ -22,6 +22,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/segmented.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -32,6 +33,40 @@ namespace ranges
         /// @{
         struct count_if_fn
         {
+        private:
+            template<typename D, typename R, typename P>
+            struct segment_fn
+            {
+                D &n_;
+                R &pred_;
+                P &proj_;
+                template<typename I, typename S>
+                bool operator()(I &begin, S end) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    for(; begin != end; ++begin)
+                        if(pred(proj(*begin)))
+                            ++n_;
+                    return false;
+                }
+            };
+            template<typename Rng, typename R, typename P>
+            static range_difference_t<Rng> impl(Rng &rng, R pred, P proj, std::false_type)
+            {
+                return count_if_fn{}(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+            // Segmented ranges are counted one inner range at a time.
+            template<typename Rng, typename R, typename P>
+            static range_difference_t<Rng> impl(Rng &rng, R pred, P proj, std::true_type)
+            {
+                range_difference_t<Rng> n = 0;
+                segment_fn<range_difference_t<Rng>, R, P> seg{n, pred, proj};
+                detail::for_each_segment(rng, seg);
+                return n;
+            }
+
+        public:
             template<typename I, typename S, typename R, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokablePredicate<R, Project<I, P> >())>
@@ -53,7 +88,8 @@ namespace ranges
             iterator_difference_t<I>
             operator()(Rng &&rng, R pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return count_if_fn::impl(rng, std::move(pred), std::move(proj),
+                    detail::is_segmented<Rng>{});
             }
         };
 
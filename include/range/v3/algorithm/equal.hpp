@@ -13,7 +13,9 @@
 #ifndef RANGES_V3_ALGORITHM_EQUAL_HPP
 #define RANGES_V3_ALGORITHM_EQUAL_HPP
 
+#include <cstring>
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/distance.hpp>
@@ -23,6 +25,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -38,6 +41,24 @@ namespace ranges
                 typename C, typename P0, typename P1>
             bool nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred_,
                 P0 proj0_, P1 proj1_) const
+            {
+                return equal_fn::nocheck_impl(std::move(begin0), std::move(end0),
+                    std::move(begin1), std::move(end1), std::move(pred_), std::move(proj0_),
+                    std::move(proj1_), meta::bool_<SizedIteratorRange<I1, S1>::value &&
+                        equal_fn::fast_path<I0, S0, I1, C, P0, P1>::value>{});
+            }
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C, typename P0, typename P1>
+            static bool nocheck_impl(I0 begin0, S0 end0, I1 begin1, S1 end1, C, P0, P1,
+                std::true_type)
+            {
+                auto const n = end0 - begin0;
+                return n == end1 - begin1 && equal_fn::compare_n(begin0, begin1, n);
+            }
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C, typename P0, typename P1>
+            static bool nocheck_impl(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred_,
+                P0 proj0_, P1 proj1_, std::false_type)
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj0 = invokable(proj0_);
@@ -47,16 +68,10 @@ namespace ranges
                         return false;
                 return begin0 == end0 && begin1 == end1;
             }
-
-        public:
             template<typename I0, typename S0, typename I1,
-                typename C = equal_to, typename P0 = ident, typename P1 = ident,
-                CONCEPT_REQUIRES_(
-                    IteratorRange<I0, S0>() &&
-                    WeaklyComparable<I0, I1, C, P0, P1>()
-                )>
-            bool operator()(I0 begin0, S0 end0, I1 begin1, C pred_ = C{},
-                P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
+                typename C, typename P0, typename P1>
+            static bool impl(I0 begin0, S0 end0, I1 begin1, C pred_, P0 proj0_, P1 proj1_,
+                std::false_type)
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj0 = invokable(proj0_);
@@ -66,6 +81,54 @@ namespace ranges
                         return false;
                 return true;
             }
+            template<typename I0, typename S0, typename I1,
+                typename C, typename P0, typename P1>
+            static bool impl(I0 begin0, S0 end0, I1 begin1, C, P0, P1, std::true_type)
+            {
+                return equal_fn::compare_n(begin0, begin1, end0 - begin0);
+            }
+            template<typename I0, typename S0, typename I1, typename C, typename P0,
+                typename P1>
+            using fast_path = meta::bool_<
+                detail::memcmp_comparable<I0, S0, I1, C, P0, P1>::value ||
+                detail::simd_comparable<I0, S0, I1, C, P0, P1>::value>;
+            template<typename I0, typename I1, typename D>
+            static bool compare_n(I0 begin0, I1 begin1, D n)
+            {
+                using E = detail::contiguous_value_t<I0>;
+                return n <= 0 || equal_fn::compare_n(detail::contiguous_data(begin0),
+                    detail::contiguous_data(begin1), static_cast<std::size_t>(n),
+                    detail::is_bytewise_comparable<E>{});
+            }
+            // Integers, enums and pointers are equal exactly when their bytes are.
+            template<typename E>
+            static bool compare_n(E const *p0, E const *p1, std::size_t n, std::true_type)
+            {
+                return 0 == std::memcmp(p0, p1, n * sizeof(E));
+            }
+#if RANGES_HAVE_X86_SIMD
+            // Floating point isn't: -0.0 == 0.0, and NaN != NaN.
+            template<typename E>
+            static bool compare_n(E const *p0, E const *p1, std::size_t n, std::false_type)
+            {
+                return detail::simd::mismatch(p0, p1, n) == n;
+            }
+#endif
+
+        public:
+            template<typename I0, typename S0, typename I1,
+                typename C = equal_to, typename P0 = ident, typename P1 = ident,
+                CONCEPT_REQUIRES_(
+                    IteratorRange<I0, S0>() &&
+                    WeaklyComparable<I0, I1, C, P0, P1>()
+                )>
+            bool operator()(I0 begin0, S0 end0, I1 begin1, C pred = C{},
+                P0 proj0 = P0{}, P1 proj1 = P1{}) const
+            {
+                return equal_fn::impl(std::move(begin0), std::move(end0), std::move(begin1),
+                    std::move(pred), std::move(proj0), std::move(proj1),
+                    equal_fn::fast_path<I0, S0, I1, C, P0, P1>{});
+            }
 
             template<typename I0, typename S0, typename I1, typename S1,
                 typename C = equal_to, typename P0 = ident, typename P1 = ident,
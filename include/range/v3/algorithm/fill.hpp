@@ -13,11 +13,14 @@
 #ifndef RANGES_V3_ALGORITHM_FILL_HPP
 #define RANGES_V3_ALGORITHM_FILL_HPP
 
+#include <cstring>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -28,14 +31,36 @@ namespace ranges
         /// @{
         struct fill_fn
         {
-            template<typename O, typename S, typename V,
-                CONCEPT_REQUIRES_(OutputIterator<O, V>() && IteratorRange<O, S>())>
-            O operator()(O begin, S end, V const & val) const
+        private:
+            template<typename O, typename S, typename V>
+            static O impl(O begin, S end, V const & val, std::false_type)
             {
                 for(; begin != end; ++begin)
                     *begin = val;
                 return begin;
             }
+            // Contiguous ranges of bytes are filled with memset.
+            template<typename O, typename S, typename V>
+            static O impl(O begin, S end, V const & val, std::true_type)
+            {
+                using E = detail::contiguous_value_t<O>;
+                auto const n = end - begin;
+                if(n > 0)
+                    std::memset(detail::contiguous_data(begin),
+                        static_cast<unsigned char>(static_cast<E>(val)),
+                        static_cast<std::size_t>(n));
+                return begin + n;
+            }
+
+        public:
+            template<typename O, typename S, typename V,
+                CONCEPT_REQUIRES_(OutputIterator<O, V>() && IteratorRange<O, S>())>
+            O operator()(O begin, S end, V const & val) const
+            {
+                return fill_fn::impl(std::move(begin), std::move(end), val,
+                    meta::bool_<std::is_arithmetic<V>::value &&
+                        detail::contiguous_bytes<O, S>::value>{});
+            }
 
             template<typename Rng, typename V,
                 typename O = range_iterator_t<Rng>,
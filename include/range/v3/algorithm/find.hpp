@@ -13,7 +13,9 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_HPP
 #define RANGES_V3_ALGORITHM_FIND_HPP
 
+#include <cstring>
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -21,6 +23,8 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/segmented.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -31,6 +35,70 @@ namespace ranges
         /// @{
         struct find_fn
         {
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static I impl(I begin, S end, V const &val, P proj_, std::false_type)
+            {
+                auto &&proj = invokable(proj_);
+                for(; begin != end; ++begin)
+                    if(proj(*begin) == val)
+                        break;
+                return begin;
+            }
+            // Contiguous ranges of bytes are searched with memchr, and other
+            // arithmetic types with the simd kernels.
+            template<typename I, typename S, typename V, typename P>
+            static I impl(I begin, S end, V const &val, P, std::true_type)
+            {
+                using E = detail::contiguous_value_t<I>;
+                auto const n = end - begin;
+                // No element compares equal to a value that E can't represent.
+                E const e = static_cast<E>(val);
+                if(n <= 0 || !detail::same_value(e, val))
+                    return begin + n;
+                return begin + find_fn::find_n(detail::contiguous_data(begin),
+                    static_cast<std::size_t>(n), e, detail::is_byte<E>{});
+            }
+            template<typename E>
+            static std::size_t find_n(E const *p, std::size_t n, E e, std::true_type)
+            {
+                auto const q = std::memchr(p, static_cast<unsigned char>(e), n);
+                return q ? static_cast<std::size_t>(static_cast<E const *>(q) - p) : n;
+            }
+#if RANGES_HAVE_X86_SIMD
+            template<typename E>
+            static std::size_t find_n(E const *p, std::size_t n, E e, std::false_type)
+            {
+                return detail::simd::find(p, n, e);
+            }
+#endif
+            template<typename V, typename P>
+            struct segment_fn
+            {
+                V const &val_;
+                P &proj_;
+                template<typename I, typename S>
+                bool operator()(I &begin, S end) const
+                {
+                    begin = find_fn{}(std::move(begin), end, val_, proj_);
+                    return begin != end;
+                }
+            };
+            template<typename Rng, typename V, typename P>
+            static range_iterator_t<Rng> impl(Rng &rng, V const &val, P proj, std::false_type)
+            {
+                return find_fn{}(begin(rng), end(rng), val, std::move(proj));
+            }
+            // Segmented ranges are searched one inner range at a time, so each one
+            // gets the memchr and simd paths above when it qualifies.
+            template<typename Rng, typename V, typename P>
+            static range_iterator_t<Rng> impl(Rng &rng, V const &val, P proj, std::true_type)
+            {
+                segment_fn<V, P> seg{val, proj};
+                return detail::for_each_segment(rng, seg);
+            }
+
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -43,13 +111,10 @@ namespace ranges
             template<typename I, typename S, typename V, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokableRelation<equal_to, Project<I, P>, Project<V const *, ident>>())>
-            I operator()(I begin, S end, V const &val, P proj_ = P{}) const
+            I operator()(I begin, S end, V const &val, P proj = P{}) const
             {
-                auto &&proj = invokable(proj_);
-                for(; begin != end; ++begin)
-                    if(proj(*begin) == val)
-                        break;
-                return begin;
+                return find_fn::impl(std::move(begin), std::move(end), val, std::move(proj),
+                    detail::contiguous_searchable<I, S, V, P>{});
             }
 
             /// \overload
@@ -59,7 +124,7 @@ namespace ranges
                     IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
             I operator()(Rng &rng, V const &val, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), val, std::move(proj));
+                return find_fn::impl(rng, val, std::move(proj), detail::is_segmented<Rng>{});
             }
         };
 
@@ -16,6 +16,7 @@
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -31,6 +32,33 @@ namespace ranges
         /// @{
         struct find_if_fn
         {
+        private:
+            template<typename F, typename P>
+            struct push_fn
+            {
+                F &pred_;
+                P &proj_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return !invokable(pred_)(invokable(proj_)(std::forward<T>(t)));
+                }
+            };
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> impl(Rng &rng, F pred, P proj, std::false_type)
+            {
+                return find_if_fn{}(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+            // Views that drive their own loop stop at the first element that
+            // satisfies the predicate.
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> impl(Rng &rng, F pred, P proj, std::true_type)
+            {
+                push_fn<F, P> push{pred, proj};
+                return ranges::for_each_while(rng, push);
+            }
+
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -61,7 +89,8 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputIterable<Rng &>() && IndirectInvokablePredicate<F, Project<I, P> >())>
             I operator()(Rng &rng, F pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return find_if_fn::impl(rng, std::move(pred), std::move(proj),
+                    detail::is_pushable<Rng>{});
             }
         };
 
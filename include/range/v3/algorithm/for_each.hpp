@@ -16,6 +16,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/invokable.hpp>
@@ -31,6 +32,33 @@ namespace ranges
         /// @{
         struct for_each_fn
         {
+        private:
+            template<typename F, typename P>
+            struct push_fn
+            {
+                F &fun_;
+                P &proj_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    invokable(fun_)(invokable(proj_)(std::forward<T>(t)));
+                    return true;
+                }
+            };
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> impl(Rng &rng, F fun, P proj, std::false_type)
+            {
+                return for_each_fn{}(begin(rng), end(rng), std::move(fun), std::move(proj));
+            }
+            // Views that drive their own loop are handed the function as a sink.
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> impl(Rng &rng, F fun, P proj, std::true_type)
+            {
+                push_fn<F, P> push{fun, proj};
+                return ranges::for_each_while(rng, push);
+            }
+
+        public:
             template<typename I, typename S, typename F, typename P = ident,
                 typename V = iterator_common_reference_t<I>,
                 typename X = concepts::Invokable::result_t<P, V>,
@@ -52,7 +80,8 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputIterable<Rng &>() && IndirectInvokable<F, Project<I, P>>())>
             I operator()(Rng &rng, F fun, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(fun), std::move(proj));
+                return for_each_fn::impl(rng, std::move(fun), std::move(proj),
+                    detail::is_pushable<Rng>{});
             }
         };
 
@@ -14,6 +14,7 @@
 #define RANGES_V3_ALGORITHM_MISMATCH_HPP
 
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -51,12 +53,11 @@ namespace ranges
         /// @{
         struct mismatch_fn
         {
-            template<typename I1, typename S1, typename I2, typename C = equal_to,
-                typename P1 = ident, typename P2 = ident,
-                CONCEPT_REQUIRES_(Mismatchable1<I1, I2, C, P1, P2>() && IteratorRange<I1, S1>())>
-            std::pair<I1, I2>
-            operator()(I1 begin1, S1 end1, I2 begin2, C pred_ = C{}, P1 proj1_ = P1{},
-                P2 proj2_ = P2{}) const
+        private:
+            template<typename I1, typename S1, typename I2, typename C, typename P1,
+                typename P2>
+            static std::pair<I1, I2> impl(I1 begin1, S1 end1, I2 begin2, C pred_, P1 proj1_,
+                P2 proj2_, std::false_type)
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj1 = invokable(proj1_);
@@ -66,14 +67,10 @@ namespace ranges
                         break;
                 return {begin1, begin2};
             }
-
-            template<typename I1, typename S1, typename I2, typename S2, typename C = equal_to,
-                typename P1 = ident, typename P2 = ident,
-                CONCEPT_REQUIRES_(Mismatchable2<I1, I2, C, P1, P2>() && IteratorRange<I1, S1>() &&
-                    IteratorRange<I2, S2>())>
-            std::pair<I1, I2>
-            operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred_ = C{}, P1 proj1_ = P1{},
-                P2 proj2_ = P2{}) const
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static std::pair<I1, I2> impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred_,
+                P1 proj1_, P2 proj2_, std::false_type)
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj1 = invokable(proj1_);
@@ -83,6 +80,64 @@ namespace ranges
                         break;
                 return {begin1, begin2};
             }
+#if RANGES_HAVE_X86_SIMD
+            // Contiguous ranges of the same arithmetic type are compared with the
+            // simd kernels.
+            template<typename I1, typename S1, typename I2, typename C, typename P1,
+                typename P2>
+            static std::pair<I1, I2> impl(I1 begin1, S1 end1, I2 begin2, C, P1, P2,
+                std::true_type)
+            {
+                return mismatch_fn::impl_n(std::move(begin1), std::move(begin2), end1 - begin1);
+            }
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static std::pair<I1, I2> impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C, P1, P2,
+                std::true_type)
+            {
+                auto const n1 = end1 - begin1;
+                auto const n2 = end2 - begin2;
+                return mismatch_fn::impl_n(std::move(begin1), std::move(begin2),
+                    n1 < n2 ? n1 : n2);
+            }
+            template<typename I1, typename I2, typename D>
+            static std::pair<I1, I2> impl_n(I1 begin1, I2 begin2, D n)
+            {
+                if(n <= 0)
+                    return {begin1, begin2};
+                auto const i = detail::simd::mismatch(detail::contiguous_data(begin1),
+                    detail::contiguous_data(begin2), static_cast<std::size_t>(n));
+                return {begin1 + static_cast<iterator_difference_t<I1>>(i),
+                    begin2 + static_cast<iterator_difference_t<I2>>(i)};
+            }
+#endif
+
+        public:
+            template<typename I1, typename S1, typename I2, typename C = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(Mismatchable1<I1, I2, C, P1, P2>() && IteratorRange<I1, S1>())>
+            std::pair<I1, I2>
+            operator()(I1 begin1, S1 end1, I2 begin2, C pred = C{}, P1 proj1 = P1{},
+                P2 proj2 = P2{}) const
+            {
+                return mismatch_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(pred), std::move(proj1), std::move(proj2),
+                    detail::simd_comparable<I1, S1, I2, C, P1, P2>{});
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(Mismatchable2<I1, I2, C, P1, P2>() && IteratorRange<I1, S1>() &&
+                    IteratorRange<I2, S2>())>
+            std::pair<I1, I2>
+            operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred = C{}, P1 proj1 = P1{},
+                P2 proj2 = P2{}) const
+            {
+                return mismatch_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(end2), std::move(pred), std::move(proj1), std::move(proj2),
+                    meta::bool_<SizedIteratorRange<I2, S2>::value &&
+                        detail::simd_comparable<I1, S1, I2, C, P1, P2>::value>{});
+            }
 
             template<typename Rng1, typename I2Ref, typename C = equal_to, typename P1 = ident,
                 typename P2 = ident,
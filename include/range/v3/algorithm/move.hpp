@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_MOVE_HPP
 #define RANGES_V3_ALGORITHM_MOVE_HPP
 
+#include <cstring>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -23,6 +24,7 @@
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/move.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -33,12 +35,9 @@ namespace ranges
         /// @{
         struct move_fn : aux::move_fn
         {
-            using aux::move_fn::operator();
-
-            template<typename I, typename S, typename O, typename P = ident,
-                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
-                    WeaklyIncrementable<O>() && IndirectlyMovable<I, O, P>())>
-            std::pair<I, O> operator()(I begin, S end, O out, P proj_ = P{}) const
+        private:
+            template<typename I, typename S, typename O, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, P proj_, std::false_type)
             {
                 auto &&proj = invokable(proj_);
                 for(; begin != end; ++begin, ++out)
@@ -49,6 +48,28 @@ namespace ranges
                 }
                 return {begin, out};
             }
+            // Moving a trivially copyable object is copying it.
+            template<typename I, typename S, typename O, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, P, std::true_type)
+            {
+                auto const n = end - begin;
+                if(n > 0)
+                    std::memmove(detail::contiguous_data(out), detail::contiguous_data(begin),
+                        static_cast<std::size_t>(n) * sizeof(detail::contiguous_value_t<I>));
+                return {begin + n, out + n};
+            }
+
+        public:
+            using aux::move_fn::operator();
+
+            template<typename I, typename S, typename O, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    WeaklyIncrementable<O>() && IndirectlyMovable<I, O, P>())>
+            std::pair<I, O> operator()(I begin, S end, O out, P proj = P{}) const
+            {
+                return move_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    std::move(proj), detail::memmove_copyable<I, S, O, P>{});
+            }
 
             template<typename Rng, typename O, typename P = ident,
                 typename I = range_iterator_t<Rng>,
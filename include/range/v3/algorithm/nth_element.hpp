@@ -34,6 +34,7 @@
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/swap.hpp>
+#include <range/v3/utility/execution_policy.hpp>
 #include <range/v3/algorithm/min_element.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -306,6 +307,32 @@ namespace ranges
             {
                 return (*this)(begin(rng), std::move(nth), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \note This overload does not parallelize: it runs the sequential
+            /// algorithm on the calling thread, whatever the policy. Selection does
+            /// linear work whose every pass depends on the previous one. The overload
+            /// exists so that code written against \c par for \c sort can use it
+            /// uniformly.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && Sortable<I, C, P>())>
+            I operator()(parallel_policy const &, I begin, I nth, S end, C pred = C{},
+                P proj = P{}) const
+            {
+                return (*this)(std::move(begin), std::move(nth), std::move(end), std::move(pred),
+                    std::move(proj));
+            }
+
+            /// \note Like the iterator overload, this does not parallelize.
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterable<Rng &>() &&
+                    Sortable<I, C, P>()
+                )>
+            I operator()(parallel_policy const &, Rng &rng, I nth, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), std::move(nth), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `nth_element_fn`
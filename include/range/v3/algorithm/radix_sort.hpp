@@ -0,0 +1,80 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+#define RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+
+#include <memory>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/aux_/radix_sort_with_buffer.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Stable sort by an integral or floating-point key, in ascending order.
+        /// Runs in O(N) time with one pass over the elements per byte of the key,
+        /// skipping bytes that all keys share. Negative zero sorts before positive
+        /// zero. If no temporary buffer is available, falls back to `stable_sort`.
+        struct radix_sort_fn
+        {
+            template<typename I, typename S, typename P = ident,
+                CONCEPT_REQUIRES_(RadixSortable<I, P>() && IteratorRange<I, S>())>
+            I operator()(I begin, S end_, P proj = P{}) const
+            {
+                I end = next_to(begin, end_);
+                using D = iterator_difference_t<I>;
+                using V = iterator_value_t<I>;
+                D len = end - begin;
+                auto buf = len > 1 ? std::get_temporary_buffer<V>(len) : detail::value_init{};
+                std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                if(buf.first != nullptr && D(buf.second) >= len)
+                    aux::radix_sort_with_buffer(begin, end, buf.first, std::move(proj));
+                else
+                    stable_sort(begin, end, ordered_less{}, std::move(proj));
+                return end;
+            }
+
+            template<typename Rng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RadixSortable<I, P>() && RandomAccessIterable<Rng &>())>
+            I operator()(Rng & rng, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(proj));
+            }
+        };
+
+        /// \sa `radix_sort_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& radix_sort = static_const<radix_sort_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
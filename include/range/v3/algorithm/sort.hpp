@@ -45,6 +45,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/algorithm/move_backward.hpp>
 #include <range/v3/algorithm/partial_sort.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
@@ -57,22 +58,24 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            template<typename Val, typename C>
-            inline Val const &median(Val const &a, Val const &b, Val const &c, C &pred)
+            // Moves the median of *a, *b and *c into *result. result must not be
+            // one of a, b or c.
+            template<typename I, typename C, typename P>
+            inline void move_median_to_first(I result, I a, I b, I c, C &pred, P &proj)
             {
-                if(pred(a, b))
-                    if(pred(b, c))
-                        return b;
-                    else if(pred(a, c))
-                        return c;
+                if(pred(proj(*a), proj(*b)))
+                    if(pred(proj(*b), proj(*c)))
+                        ranges::iter_swap(result, b);
+                    else if(pred(proj(*a), proj(*c)))
+                        ranges::iter_swap(result, c);
                     else
-                        return a;
-                else if(pred(a, c))
-                    return a;
-                else if(pred(b, c))
-                    return c;
+                        ranges::iter_swap(result, a);
+                else if(pred(proj(*a), proj(*c)))
+                    ranges::iter_swap(result, a);
+                else if(pred(proj(*b), proj(*c)))
+                    ranges::iter_swap(result, c);
                 else
-                    return b;
+                    ranges::iter_swap(result, b);
             }
 
             template<typename I, typename Val, typename C, typename P>
@@ -92,6 +95,17 @@ namespace ranges
                 }
             }
 
+            // Partitions [begin, end) around the median of three elements, which is
+            // parked in *begin so that it doesn't move while the rest is partitioned.
+            // Requires end - begin >= 3.
+            template<typename I, typename C, typename P>
+            inline I partition_around_median(I begin, I end, C &pred, P &proj)
+            {
+                detail::move_median_to_first(begin, begin + 1, begin + (end - begin) / 2, end - 1,
+                    pred, proj);
+                return detail::unguarded_partition(begin + 1, end, proj(*begin), pred, proj);
+            }
+
             template<typename I, typename C, typename P>
             inline void unguarded_linear_insert(I end, iterator_value_t<I> val, C &pred, P &proj)
             {
@@ -175,15 +189,40 @@ namespace ranges
                 {
                     if(depth_limit == 0)
                         return partial_sort(begin, end, end, std::ref(pred), std::ref(proj)), void();
-                    I cut = detail::unguarded_partition(begin, end,
-                        detail::median(proj(*begin), proj(*(begin + (end - begin) / 2)),
-                            proj(*(end - 1)), pred),
-                        pred, proj);
+                    I cut = detail::partition_around_median(begin, end, pred, proj);
                     sort_fn::introsort_loop(cut, end, depth_limit - 1, pred, proj);
                     end = cut;
                 }
             }
 
+            // Below this size, a partition isn't worth handing to another thread.
+            static constexpr int parallel_sort_threshold() { return 1 << 14; }
+
+            // Partition sequentially, then sort the two sides concurrently until
+            // the thread budget is spent, and finish each piece with introsort.
+            template<typename I, typename Size, typename C, typename P>
+            static void parallel_introsort(I begin, I end, Size depth_limit, unsigned threads,
+                C &pred, P &proj)
+            {
+                if(threads > 1 && depth_limit != 0 && end - begin > sort_fn::parallel_sort_threshold())
+                {
+                    I cut = detail::partition_around_median(begin, end, pred, proj);
+                    unsigned n = detail::split_threads(threads, cut - begin, end - cut);
+                    detail::parallel_invoke(
+                        [=, &pred, &proj]
+                        {
+                            sort_fn::parallel_introsort(begin, cut, depth_limit - 1, n, pred, proj);
+                        },
+                        [=, &pred, &proj]
+                        {
+                            sort_fn::parallel_introsort(cut, end, depth_limit - 1, threads - n,
+                                pred, proj);
+                        });
+                }
+                else
+                    sort_fn{}(begin, end, std::ref(pred), std::ref(proj));
+            }
+
         public:
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
@@ -207,6 +246,30 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+            I operator()(parallel_policy const &policy, I begin, S end_, C pred_ = C{},
+                P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                if(begin == end_)
+                    return begin;
+                I end = next_to(begin, end_);
+                sort_fn::parallel_introsort(begin, end, sort_fn::log2(end - begin) * 2,
+                    detail::concurrency(policy), pred, proj);
+                return end;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterable<Rng &>())>
+            I operator()(parallel_policy const &policy, Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `sort_fn`
@@ -51,9 +51,14 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/counted_iterator.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/algorithm/merge_move.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/algorithm/aux_/radix_sort_with_buffer.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -150,6 +155,200 @@ namespace ranges
                     buffer, buffer_size, std::ref(pred), std::ref(proj));
             }
 
+            // With the default ordering and an integral key, a radix sort gives the
+            // same result as a stable comparison sort in linear time. Floating-point
+            // keys are excluded because the radix sort orders -0.0 before +0.0.
+            template<typename I, typename C, typename P>
+            using radix_sortable = meta::and_<
+                meta::or_<Same<C, ordered_less>, Same<C, less>>,
+                RadixSortable<I, P>,
+                std::is_integral<concepts::Readable::value_t<Project<I, P>>>>;
+
+            template<typename I, typename V, typename D, typename C, typename P>
+            static void sort_with_buffer(I begin, I end, V *buffer, D buffer_size, C &pred,
+                P &proj, std::true_type)
+            {
+                if(buffer_size >= end - begin)
+                    aux::radix_sort_with_buffer(begin, end, buffer, std::ref(proj));
+                else
+                    stable_sort_fn::stable_sort_adaptive(begin, end, buffer, buffer_size, pred,
+                        proj);
+            }
+
+            template<typename I, typename V, typename D, typename C, typename P>
+            static void sort_with_buffer(I begin, I end, V *buffer, D buffer_size, C &pred,
+                P &proj, std::false_type)
+            {
+                stable_sort_fn::stable_sort_adaptive(begin, end, buffer, buffer_size, pred, proj);
+            }
+
+            // Below this size, a half isn't worth handing to another thread.
+            static constexpr int parallel_sort_threshold() { return 1 << 14; }
+
+            template<typename V>
+            static void destroy(V *begin, V *end) noexcept
+            {
+                for(; begin != end; ++begin)
+                    begin->~V();
+            }
+
+            // Moves [begin, end) into the raw storage at buffer, half on each of
+            // two threads until the thread budget is spent. If a move throws, the
+            // objects already made are destroyed again.
+            template<typename I, typename V>
+            static void parallel_move_to_buffer(I begin, I end, V *buffer, unsigned threads)
+            {
+                if(threads > 1 && end - begin > stable_sort_fn::parallel_sort_threshold())
+                {
+                    I middle = begin + (end - begin) / 2;
+                    V *buffer_middle = buffer + (middle - begin);
+                    V *buffer_end = buffer + (end - begin);
+                    unsigned n = threads / 2;
+                    bool left = false, right = false;
+                    try
+                    {
+                        detail::parallel_invoke(
+                            [=, &left]
+                            {
+                                stable_sort_fn::parallel_move_to_buffer(begin, middle, buffer,
+                                    threads - n);
+                                left = true;
+                            },
+                            [=, &right]
+                            {
+                                stable_sort_fn::parallel_move_to_buffer(middle, end,
+                                    buffer_middle, n);
+                                right = true;
+                            });
+                    }
+                    catch(...)
+                    {
+                        if(left)
+                            stable_sort_fn::destroy(buffer, buffer_middle);
+                        if(right)
+                            stable_sort_fn::destroy(buffer_middle, buffer_end);
+                        throw;
+                    }
+                }
+                else
+                {
+                    std::unique_ptr<V, detail::destroy_n<V>> h{buffer, {}};
+                    move(begin, end, ranges::make_counted_raw_storage_iterator(buffer,
+                        h.get_deleter()));
+                    h.release();
+                }
+            }
+
+            // Merges the sorted runs [begin1, end1) and [begin2, end2) of the buffer
+            // to out, destroying them as it goes. The longer run is split at its
+            // middle element and the other where that element would be merged in,
+            // the elements of the first run going before equal ones of the second,
+            // and the two pairs of halves are merged concurrently.
+            template<typename V, typename I, typename C, typename P>
+            static void parallel_merge_from_buffer(V *begin1, V *end1, V *begin2, V *end2,
+                I out, unsigned threads, C &pred, P &proj)
+            {
+                if(threads > 1 &&
+                   (end1 - begin1) + (end2 - begin2) > stable_sort_fn::parallel_sort_threshold())
+                {
+                    V *middle1, *middle2;
+                    try
+                    {
+                        if(end1 - begin1 >= end2 - begin2)
+                        {
+                            middle1 = begin1 + (end1 - begin1) / 2;
+                            middle2 = lower_bound(begin2, end2, proj(*middle1), std::ref(pred),
+                                std::ref(proj));
+                        }
+                        else
+                        {
+                            middle2 = begin2 + (end2 - begin2) / 2;
+                            middle1 = upper_bound(begin1, end1, proj(*middle2), std::ref(pred),
+                                std::ref(proj));
+                        }
+                    }
+                    catch(...)
+                    {
+                        stable_sort_fn::destroy(begin1, end1);
+                        stable_sort_fn::destroy(begin2, end2);
+                        throw;
+                    }
+                    auto const left = (middle1 - begin1) + (middle2 - begin2);
+                    unsigned n = detail::split_threads(threads, left,
+                        (end1 - middle1) + (end2 - middle2));
+                    detail::parallel_invoke(
+                        [=, &pred, &proj]
+                        {
+                            stable_sort_fn::parallel_merge_from_buffer(begin1, middle1, begin2,
+                                middle2, out, n, pred, proj);
+                        },
+                        [=, &pred, &proj]
+                        {
+                            stable_sort_fn::parallel_merge_from_buffer(middle1, end1, middle2,
+                                end2, out + left, threads - n, pred, proj);
+                        });
+                }
+                else
+                {
+                    struct guard
+                    {
+                        V *begin1, *end1, *begin2, *end2;
+                        ~guard()
+                        {
+                            stable_sort_fn::destroy(begin1, end1);
+                            stable_sort_fn::destroy(begin2, end2);
+                        }
+                    } g{begin1, end1, begin2, end2};
+                    merge_move(begin1, end1, begin2, end2, out, std::ref(pred), std::ref(proj),
+                        std::ref(proj));
+                }
+            }
+
+            // Merges the sorted runs [begin, middle) and [middle, end) by way of a
+            // buffer, so that the merge is split across threads as well. Without
+            // room for a buffer, the merge is done in place on one thread.
+            template<typename I, typename C, typename P>
+            static void parallel_merge(I begin, I middle, I end, unsigned threads, C &pred,
+                P &proj)
+            {
+                using V = iterator_value_t<I>;
+                auto const len = end - begin;
+                auto buf = std::get_temporary_buffer<V>(len);
+                std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                if(buf.second < len)
+                    return inplace_merge(begin, middle, end, std::ref(pred), std::ref(proj)),
+                        void();
+                V *buffer = buf.first, *buffer_middle = buffer + (middle - begin);
+                stable_sort_fn::parallel_move_to_buffer(begin, end, buffer, threads);
+                stable_sort_fn::parallel_merge_from_buffer(buffer, buffer_middle, buffer_middle,
+                    buffer + len, begin, threads, pred, proj);
+            }
+
+            // Sort the two halves concurrently until the thread budget is spent,
+            // then merge them back together, also concurrently.
+            template<typename I, typename C, typename P>
+            static void parallel_stable_sort(I begin, I end, unsigned threads, C &pred, P &proj)
+            {
+                if(threads > 1 && end - begin > stable_sort_fn::parallel_sort_threshold())
+                {
+                    I middle = begin + (end - begin) / 2;
+                    unsigned n = threads / 2;
+                    detail::parallel_invoke(
+                        [=, &pred, &proj]
+                        {
+                            stable_sort_fn::parallel_stable_sort(begin, middle, threads - n,
+                                pred, proj);
+                        },
+                        [=, &pred, &proj]
+                        {
+                            stable_sort_fn::parallel_stable_sort(middle, end, n, pred, proj);
+                        });
+                    stable_sort_fn::parallel_merge(begin, middle, end, threads, pred, proj);
+                }
+                else
+                    stable_sort_fn{}(begin, end, std::ref(pred), std::ref(proj));
+            }
+
         public:
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
@@ -167,7 +366,8 @@ namespace ranges
                 if(buf.first == nullptr)
                     stable_sort_fn::inplace_stable_sort(begin, end, pred, proj);
                 else
-                    stable_sort_fn::stable_sort_adaptive(begin, end, buf.first, D(buf.second), pred, proj);
+                    stable_sort_fn::sort_with_buffer(begin, end, buf.first, D(buf.second), pred, proj,
+                        meta::bool_<stable_sort_fn::radix_sortable<I, C, P>::value>{});
                 return end;
             }
 
@@ -178,6 +378,32 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Sorts the two halves of the range on separate threads, recursively,
+            /// and merges them on several threads by way of a buffer. If there is
+            /// no memory for the buffer, each merge is done in place on one thread,
+            /// which limits the speedup.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+            I operator()(parallel_policy const &policy, I begin, S end_, C pred_ = C{},
+                P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                I end = next_to(begin, end_);
+                stable_sort_fn::parallel_stable_sort(begin, end, detail::concurrency(policy), pred,
+                    proj);
+                return end;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterable<Rng &>())>
+            I operator()(parallel_policy const &policy, Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `stable_sort_fn`
@@ -0,0 +1,358 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_BUFFERED_INPUT_RANGE_HPP
+#define RANGES_V3_BUFFERED_INPUT_RANGE_HPP
+
+#include <limits>
+#include <locale>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <sstream>
+#include <streambuf>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_facade.hpp>
+
+#if RANGES_HAVE_UNISTD_H
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            inline bool is_space(char c)
+            {
+                // ' ', or one of '\t', '\n', '\v', '\f' and '\r', which are contiguous.
+                return c == ' ' || static_cast<unsigned char>(c - '\t') <= '\r' - '\t';
+            }
+
+            inline unsigned digit_value(char c)
+            {
+                return static_cast<unsigned>(static_cast<unsigned char>(c) - '0');
+            }
+
+            // Reads whitespace-separated tokens out of large blocks. A token that runs
+            // off the end of the buffer is moved to the front before the next block is
+            // read behind it; a token longer than the whole buffer grows the buffer.
+            struct block_reader
+            {
+            private:
+                std::streambuf *sb_;
+                int fd_;
+                std::vector<char> buf_;
+                std::size_t pos_, end_;
+                bool eof_;
+
+                std::size_t read(char *p, std::size_t n)
+                {
+                    if(sb_)
+                    {
+                        std::streamsize r = sb_->sgetn(p, static_cast<std::streamsize>(n));
+                        return r > 0 ? static_cast<std::size_t>(r) : 0u;
+                    }
+#if RANGES_HAVE_UNISTD_H
+                    while(true)
+                    {
+                        auto r = ::read(fd_, p, n);
+                        if(r >= 0)
+                            return static_cast<std::size_t>(r);
+                        if(errno != EINTR)
+                            return 0;
+                    }
+#else
+                    return 0;
+#endif
+                }
+                void fill()
+                {
+                    if(end_ == buf_.size())
+                        buf_.resize(buf_.size() * 2);
+                    std::size_t n = read(buf_.data() + end_, buf_.size() - end_);
+                    eof_ = n == 0;
+                    end_ += n;
+                }
+            public:
+                block_reader(std::streambuf *sb, int fd, std::size_t block_size)
+                  : sb_(sb), fd_(fd), buf_(block_size != 0 ? block_size : 1), pos_(0), end_(0)
+                  , eof_(false)
+                {}
+                // On success, [b, e) is the next token. It stays valid until the next call.
+                bool next_token(char const *&b, char const *&e)
+                {
+                    std::size_t scanned = pos_;
+                    while(true)
+                    {
+                        // Work on local pointers; a char store could alias the members.
+                        char const *const first = buf_.data(), *const last = first + end_;
+                        char const *p = first + pos_, *q = first + scanned;
+                        while(p != last && detail::is_space(*p))
+                            ++p;
+                        if(q < p)
+                            q = p;
+                        while(q != last && !detail::is_space(*q))
+                            ++q;
+                        if(p != last && (q != last || eof_))
+                        {
+                            b = p;
+                            e = q;
+                            pos_ = static_cast<std::size_t>(q - first);
+                            return true;
+                        }
+                        if(eof_)
+                            return false;
+                        // Keep the partial token, if any, and read another block behind it.
+                        pos_ = static_cast<std::size_t>(p - first);
+                        scanned = static_cast<std::size_t>(q - first) - pos_;
+                        std::memmove(buf_.data(), buf_.data() + pos_, end_ - pos_);
+                        end_ -= pos_;
+                        pos_ = 0;
+                        fill();
+                    }
+                }
+            };
+
+            // Locale-independent, but accepts what operator>> in the "C" locale would.
+            template<typename T>
+            bool parse_number_slow(char const *b, char const *e, T &out)
+            {
+                std::istringstream sin{std::string(b, e)};
+                sin.imbue(std::locale::classic());
+                T t;
+                sin >> t;
+                if(sin.fail() || sin.peek() != std::char_traits<char>::eof())
+                    return false;
+                out = t;
+                return true;
+            }
+
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_integral<T>::value)>
+            bool parse_number(char const *b, char const *e, T &out)
+            {
+                using U = typename std::make_unsigned<T>::type;
+                bool neg = false;
+                if(b != e && (*b == '+' || *b == '-'))
+                    neg = *b++ == '-';
+                if(b == e || (neg && std::is_unsigned<T>::value))
+                    return false;
+                U const limit = neg ? U(U(std::numeric_limits<T>::max()) + 1u) :
+                    U(std::numeric_limits<T>::max());
+                U const limit_div = limit / 10, limit_mod = limit % 10;
+                U val = 0;
+                for(; b != e; ++b)
+                {
+                    unsigned d = detail::digit_value(*b);
+                    if(d > 9 || val > limit_div || (val == limit_div && d > limit_mod))
+                        return false;
+                    val = U(val * 10 + d);
+                }
+                out = !neg ? T(val) : val == 0 ? T(0) : T(-T(val - 1) - 1);
+                return true;
+            }
+
+            // Mantissas of up to 19 digits with small exponents are converted exactly
+            // (both operands of the final multiply or divide are exact, so the result
+            // is correctly rounded). Everything else takes the slow path.
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_floating_point<T>::value)>
+            bool parse_number(char const *b, char const *e, T &out)
+            {
+                static double const powers[] = {
+                    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+                bool const single = sizeof(T) == sizeof(float);
+                int const max_exp = single ? 10 : 22;
+                std::uint64_t const max_mantissa = single ? (1ull << 24) : (1ull << 53);
+                char const *p = b;
+                bool neg = false;
+                if(p != e && (*p == '+' || *p == '-'))
+                    neg = *p++ == '-';
+                std::uint64_t m = 0;
+                int exp10 = 0;
+                bool any = false, truncated = false;
+                unsigned d;
+                for(; p != e && (d = detail::digit_value(*p)) <= 9; ++p, any = true)
+                {
+                    if(m < 1000000000000000000ull)
+                        m = m * 10 + d;
+                    else
+                        ++exp10, truncated |= d != 0;
+                }
+                if(p != e && *p == '.')
+                    for(++p; p != e && (d = detail::digit_value(*p)) <= 9; ++p, any = true)
+                    {
+                        if(m < 1000000000000000000ull)
+                            m = m * 10 + d, --exp10;
+                        else
+                            truncated |= d != 0;
+                    }
+                if(any && p != e && (*p == 'e' || *p == 'E'))
+                {
+                    ++p;
+                    bool exp_neg = false;
+                    if(p != e && (*p == '+' || *p == '-'))
+                        exp_neg = *p++ == '-';
+                    int x = 0;
+                    bool exp_any = false;
+                    for(; p != e && (d = detail::digit_value(*p)) <= 9; ++p, exp_any = true)
+                        if(x < 100000)
+                            x = x * 10 + static_cast<int>(d);
+                    if(!exp_any)
+                        return false;
+                    exp10 += exp_neg ? -x : x;
+                }
+                if(!any || p != e || truncated || m > max_mantissa ||
+                   exp10 < -max_exp || exp10 > max_exp)
+                    return detail::parse_number_slow(b, e, out);
+                T val = static_cast<T>(m);
+                T const scale = static_cast<T>(powers[exp10 < 0 ? -exp10 : exp10]);
+                val = exp10 < 0 ? val / scale : val * scale;
+                out = neg ? -val : val;
+                return true;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// A single-pass range of the whitespace-separated numbers in a stream
+        /// buffer or file descriptor. Input is read in blocks of \c block_size
+        /// bytes and parsed without going through \c std::istream, the locale or
+        /// a virtual call per element. The range ends at end of input, or at the
+        /// first token that is not a number of type \c Val.
+        template<typename Val>
+        struct buffered_input_range
+          : range_facade<buffered_input_range<Val>>
+        {
+            static_assert(std::is_arithmetic<Val>::value &&
+                !std::is_same<Val, bool>::value &&
+                !std::is_same<Val, char>::value &&
+                !std::is_same<Val, signed char>::value &&
+                !std::is_same<Val, unsigned char>::value,
+                "buffered_input_range parses numbers; Val must be a numeric type.");
+        private:
+            friend range_access;
+            std::shared_ptr<detail::block_reader> in_;
+            Val obj_;
+            bool done_;
+            struct cursor
+            {
+            private:
+                buffered_input_range *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(buffered_input_range &rng)
+                  : rng_(&rng)
+                {}
+                void next()
+                {
+                    rng_->next();
+                }
+                Val const &current() const
+                {
+                    return rng_->obj_;
+                }
+                bool done() const
+                {
+                    return rng_->done_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                return cursor{*this};
+            }
+            void next()
+            {
+                char const *b, *e;
+                done_ = !in_->next_token(b, e) || !detail::parse_number(b, e, obj_);
+            }
+            buffered_input_range(std::streambuf *sb, int fd, std::size_t block_size)
+              : in_(std::make_shared<detail::block_reader>(sb, fd, block_size)), obj_{}
+              , done_(false)
+            {
+                next(); // prime the pump
+            }
+        public:
+            static constexpr std::size_t default_block_size = 1 << 16;
+
+            buffered_input_range()
+              : in_(), obj_{}, done_(true)
+            {}
+            explicit buffered_input_range(std::streambuf &sb,
+                std::size_t block_size = default_block_size)
+              : buffered_input_range(&sb, -1, block_size)
+            {}
+            /// Reads straight from \c sin's stream buffer, bypassing its formatting
+            /// state.
+            explicit buffered_input_range(std::istream &sin,
+                std::size_t block_size = default_block_size)
+              : buffered_input_range(sin.rdbuf(), -1, block_size)
+            {}
+#if RANGES_HAVE_UNISTD_H
+            explicit buffered_input_range(int fd, std::size_t block_size = default_block_size)
+              : buffered_input_range(nullptr, fd, block_size)
+            {}
+#endif
+            Val & cached()
+            {
+                return obj_;
+            }
+        };
+
+        template<typename Val>
+        constexpr std::size_t buffered_input_range<Val>::default_block_size;
+
+        namespace view
+        {
+            /// \ingroup group-views
+            template<typename Val>
+            buffered_input_range<Val> buffered_input(std::streambuf &sb,
+                std::size_t block_size = buffered_input_range<Val>::default_block_size)
+            {
+                return buffered_input_range<Val>{sb, block_size};
+            }
+
+            /// \overload
+            template<typename Val>
+            buffered_input_range<Val> buffered_input(std::istream &sin,
+                std::size_t block_size = buffered_input_range<Val>::default_block_size)
+            {
+                return buffered_input_range<Val>{sin, block_size};
+            }
+
+#if RANGES_HAVE_UNISTD_H
+            /// \overload
+            template<typename Val>
+            buffered_input_range<Val> buffered_input(int fd,
+                std::size_t block_size = buffered_input_range<Val>::default_block_size)
+            {
+                return buffered_input_range<Val>{fd, block_size};
+            }
+#endif
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -50,6 +50,29 @@
 #endif
 #endif
 
+#ifndef RANGES_HAVE_UNISTD_H
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#define RANGES_HAVE_UNISTD_H 1
+#else
+#define RANGES_HAVE_UNISTD_H 0
+#endif
+#endif
+
+#ifndef RANGES_HAVE_POSIX_MMAP
+#define RANGES_HAVE_POSIX_MMAP RANGES_HAVE_UNISTD_H
+#endif
+
+// SSE2 kernels for some algorithms on contiguous ranges, with AVX2 versions
+// selected at run time. SSE2 is part of the x86-64 baseline.
+#ifndef RANGES_HAVE_X86_SIMD
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define RANGES_HAVE_X86_SIMD 1
+#else
+#define RANGES_HAVE_X86_SIMD 0
+#endif
+#endif
+
 #if __cplusplus > 201103
 #define RANGES_DEPRECATED(MSG) [[deprecated(MSG)]]
 #else
@@ -0,0 +1,111 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FOR_EACH_BLOCK_HPP
+#define RANGES_V3_FOR_EACH_BLOCK_HPP
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/blocks.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A bounded contiguous range of numbers hands out blocks of itself
+            // without copying.
+            template<typename Rng>
+            using is_block_source = meta::and_<
+                std::is_arithmetic<range_value_t<Rng>>,
+                is_contiguous_iterator<range_iterator_t<Rng>>,
+                std::is_same<range_iterator_t<Rng>, range_sentinel_t<Rng>>>;
+
+            template<typename Rng>
+            using is_blockable = meta::or_<has_for_each_block<Rng>, is_block_source<Rng>>;
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// Calls `sink(p, n)` with successive blocks of the elements of `rng`, where
+        /// `p` points to `n` values of type `range_value_t<Rng> const`, until the
+        /// range is exhausted. Blocks hold at most 256 elements and are valid only
+        /// for the duration of the call.
+        ///
+        /// Bounded contiguous ranges of arithmetic type are the block sources. A view
+        /// over one may take part with a member
+        /// `template<typename Sink> void for_each_block(Sink &)`, reached through
+        /// `range_access`, that runs its stage over each block from its base into a
+        /// buffer on the stack and passes that on. Each stage is then a tight loop
+        /// over an array that the compiler can vectorize, rather than a step in a
+        /// chain of iterator increments. \c view::transform (and so
+        /// \c view::replace_if) and \c view::remove_if (and so \c view::filter) do.
+        ///
+        /// \c copy and \c to_container go through here when a stage of the
+        /// pipeline filters. A filter feeding a store otherwise costs a branch per
+        /// element, where here it is a compaction into the buffer with none.
+        /// Without a filter, or when the sink only reduces as \c accumulate's does,
+        /// the compiler already makes one vectorized loop of `for_each_while`.
+        struct for_each_block_fn
+        {
+        private:
+            template<typename Rng, typename Sink>
+            static void impl(Rng &rng, Sink &sink, std::false_type)
+            {
+                auto begin = ranges::begin(rng);
+                auto const end = ranges::end(rng);
+                if(begin == end)
+                    return;
+                auto const *p = detail::contiguous_data(begin);
+                for(std::ptrdiff_t n = end - begin; n > 0; n -= detail::block_size,
+                    p += detail::block_size)
+                    sink(p, n < detail::block_size ? n : detail::block_size);
+            }
+            template<typename Rng, typename Sink>
+            static void impl(Rng &rng, Sink &sink, std::true_type)
+            {
+                range_access::for_each_block(rng, sink);
+            }
+        public:
+            template<typename Rng, typename Sink,
+                CONCEPT_REQUIRES_(InputIterable<Rng &>() && detail::is_blockable<Rng>())>
+            void operator()(Rng &rng, Sink &&sink) const
+            {
+                for_each_block_fn::impl(rng, sink, detail::has_for_each_block<Rng>{});
+            }
+        };
+
+        /// \ingroup group-core
+        /// \sa `for_each_block_fn`
+        namespace
+        {
+            constexpr auto&& for_each_block = static_const<for_each_block_fn>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
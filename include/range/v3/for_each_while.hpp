@@ -0,0 +1,131 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FOR_EACH_WHILE_HPP
+#define RANGES_V3_FOR_EACH_WHILE_HPP
+
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/segmented.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            struct push_sink_archetype
+            {
+                template<typename T>
+                bool operator()(T &&) const;
+            };
+
+            template<typename Rng, typename Enable = void>
+            struct has_for_each_while
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct has_for_each_while<Rng, void_t<decltype(range_access::for_each_while(
+                std::declval<Rng &>(), std::declval<push_sink_archetype &>()))>>
+              : std::true_type
+            {};
+
+            // Whether for_each_while can do better on Rng than a loop over its
+            // iterators.
+            template<typename Rng>
+            using is_pushable = meta::or_<has_for_each_while<Rng>, is_segmented<Rng>>;
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// Calls `sink` with each element of `rng` in turn until it returns false,
+        /// and returns an iterator to the element it declined, or the end of the
+        /// range.
+        ///
+        /// A view may drive this loop itself with a member
+        /// `template<typename Sink> range_iterator_t<View> for_each_while(Sink &)`,
+        /// reached through `range_access`, that wraps the sink in its own step and
+        /// hands it to `for_each_while` on its base. A pipeline of such views then
+        /// runs as one loop over the innermost range, without the iterator and
+        /// sentinel traffic between stages. Segmented ranges are walked a segment
+        /// at a time, and anything else with its iterators.
+        struct for_each_while_fn
+        {
+        private:
+            template<typename Sink>
+            struct segment_fn
+            {
+                Sink &sink_;
+                template<typename I, typename S>
+                bool operator()(I &begin, S end) const
+                {
+                    for(; begin != end; ++begin)
+                        if(!sink_(*begin))
+                            return true;
+                    return false;
+                }
+            };
+            template<typename Rng, typename Sink>
+            static range_iterator_t<Rng> impl(Rng &rng, Sink &sink, meta::size_t<0>)
+            {
+                auto begin = ranges::begin(rng);
+                auto const end = ranges::end(rng);
+                for(; begin != end; ++begin)
+                    if(!sink(*begin))
+                        break;
+                return begin;
+            }
+            template<typename Rng, typename Sink>
+            static range_iterator_t<Rng> impl(Rng &rng, Sink &sink, meta::size_t<1>)
+            {
+                segment_fn<Sink> seg{sink};
+                return detail::for_each_segment(rng, seg);
+            }
+            template<typename Rng, typename Sink>
+            static range_iterator_t<Rng> impl(Rng &rng, Sink &sink, meta::size_t<2>)
+            {
+                return range_access::for_each_while(rng, sink);
+            }
+        public:
+            template<typename Rng, typename Sink,
+                CONCEPT_REQUIRES_(InputIterable<Rng &>())>
+            range_iterator_t<Rng> operator()(Rng &rng, Sink &&sink) const
+            {
+                return for_each_while_fn::impl(rng, sink,
+                    meta::size_t<detail::has_for_each_while<Rng>::value ? 2 :
+                        detail::is_segmented<Rng>::value ? 1 : 0>{});
+            }
+        };
+
+        /// \ingroup group-core
+        /// \sa `for_each_while_fn`
+        namespace
+        {
+            constexpr auto&& for_each_while = static_const<for_each_while_fn>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
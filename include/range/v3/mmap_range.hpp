@@ -0,0 +1,206 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_MMAP_RANGE_HPP
+#define RANGES_V3_MMAP_RANGE_HPP
+
+#include <range/v3/detail/config.hpp>
+
+#if RANGES_HAVE_POSIX_MMAP
+
+#include <cerrno>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <type_traits>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_interface.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// How the pages of a mapped file are expected to be accessed. Passed on to
+        /// the kernel with \c madvise so it can tune read-ahead.
+        enum class mmap_advice
+        {
+            normal,
+            sequential,
+            random,
+            willneed
+        };
+
+        /// \cond
+        namespace detail
+        {
+            struct mapped_file
+            {
+            private:
+                void *addr_;
+                std::size_t size_;
+            public:
+                mapped_file(std::string const &path, mmap_advice advice)
+                  : addr_(nullptr), size_(0)
+                {
+                    int fd = ::open(path.c_str(), O_RDONLY);
+                    if(fd == -1)
+                        throw std::system_error(errno, std::system_category(), "open: " + path);
+                    struct ::stat st;
+                    if(::fstat(fd, &st) == -1)
+                    {
+                        int err = errno;
+                        ::close(fd);
+                        throw std::system_error(err, std::system_category(), "fstat: " + path);
+                    }
+                    // Pipes, devices and the like have no size to map; rather than
+                    // show them as empty, refuse them.
+                    if(!S_ISREG(st.st_mode))
+                    {
+                        ::close(fd);
+                        throw std::system_error(EINVAL, std::system_category(),
+                            "not a regular file: " + path);
+                    }
+                    size_ = static_cast<std::size_t>(st.st_size);
+                    // mmap rejects empty mappings; an empty file is an empty range.
+                    if(size_ != 0)
+                    {
+                        addr_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if(addr_ == MAP_FAILED)
+                        {
+                            int err = errno;
+                            ::close(fd);
+                            throw std::system_error(err, std::system_category(), "mmap: " + path);
+                        }
+                        ::madvise(addr_, size_, mapped_file::to_madv(advice));
+                    }
+                    // The mapping keeps the file alive; the descriptor isn't needed.
+                    ::close(fd);
+                }
+                mapped_file(mapped_file const &) = delete;
+                mapped_file &operator=(mapped_file const &) = delete;
+                ~mapped_file()
+                {
+                    if(addr_)
+                        ::munmap(addr_, size_);
+                }
+                void const *data() const
+                {
+                    return addr_;
+                }
+                std::size_t size() const
+                {
+                    return size_;
+                }
+                static int to_madv(mmap_advice advice)
+                {
+                    switch(advice)
+                    {
+                    case mmap_advice::sequential:
+                        return MADV_SEQUENTIAL;
+                    case mmap_advice::random:
+                        return MADV_RANDOM;
+                    case mmap_advice::willneed:
+                        return MADV_WILLNEED;
+                    default:
+                        return MADV_NORMAL;
+                    }
+                }
+            };
+        }
+        /// \endcond
+
+        /// A read-only, contiguous view of a file's contents as an array of \c T,
+        /// backed by a private memory mapping. Copies share the mapping, which is
+        /// released when the last copy is destroyed. A trailing partial \c T at the
+        /// end of the file is not part of the range. Throws \c std::system_error if
+        /// the file can't be opened or mapped, or isn't a regular file.
+        template<typename T>
+        struct mmap_range
+          : range_interface<mmap_range<T>>
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_range can only present a file as an array of trivially copyable objects.");
+        private:
+            std::shared_ptr<detail::mapped_file> file_;
+            T const *begin_;
+            T const *end_;
+        public:
+            mmap_range()
+              : file_(), begin_(nullptr), end_(nullptr)
+            {}
+            explicit mmap_range(std::string const &path,
+                mmap_advice advice = mmap_advice::sequential)
+              : file_(std::make_shared<detail::mapped_file>(path, advice))
+              , begin_(static_cast<T const *>(file_->data()))
+              , end_(begin_ + file_->size() / sizeof(T))
+            {}
+            T const *begin() const
+            {
+                return begin_;
+            }
+            T const *end() const
+            {
+                return end_;
+            }
+            T const *data() const
+            {
+                return begin_;
+            }
+            std::size_t size() const
+            {
+                return static_cast<std::size_t>(end_ - begin_);
+            }
+        };
+
+        /// Maps the file at \c path and presents it as an array of \c T.
+        template<typename T>
+        mmap_range<T> mmap_file(std::string const &path,
+            mmap_advice advice = mmap_advice::sequential)
+        {
+            return mmap_range<T>{path, advice};
+        }
+
+        namespace view
+        {
+            struct mapped_chars_fn
+            {
+                mmap_range<char> operator()(std::string const &path,
+                    mmap_advice advice = mmap_advice::sequential) const
+                {
+                    return mmap_range<char>{path, advice};
+                }
+            };
+
+            /// \ingroup group-views
+            /// \sa `mapped_chars_fn`
+            namespace
+            {
+                constexpr auto&& mapped_chars = static_const<mapped_chars_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif // RANGES_HAVE_POSIX_MMAP
+
+#endif
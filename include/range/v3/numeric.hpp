@@ -13,8 +13,12 @@
 
 #include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/numeric/adjacent_difference.hpp>
+#include <range/v3/numeric/delta_encode.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include <range/v3/numeric/inner_product.hpp>
 #include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/numeric/reproducible_sum.hpp>
+#include <range/v3/numeric/scan.hpp>
 
 #endif
@@ -13,11 +13,16 @@
 #ifndef RANGES_V3_NUMERIC_ACCUMULATE_HPP
 #define RANGES_V3_NUMERIC_ACCUMULATE_HPP
 
+#include <cstddef>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/execution_policy.hpp>
+#include <range/v3/utility/simd.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -38,6 +43,65 @@ namespace ranges
 
         struct accumulate_fn
         {
+        private:
+            template<typename T, typename Op, typename P>
+            struct push_fn
+            {
+                T &init_;
+                Op &op_;
+                P &proj_;
+                template<typename U>
+                bool operator()(U &&u) const
+                {
+                    init_ = invokable(op_)(init_, invokable(proj_)(std::forward<U>(u)));
+                    return true;
+                }
+            };
+            template<typename Rng, typename T, typename Op, typename P>
+            static T impl(Rng &rng, T init, Op op, P proj, std::false_type)
+            {
+                return accumulate_fn{}(begin(rng), end(rng), std::move(init), std::move(op),
+                    std::move(proj));
+            }
+            // Views that drive their own loop are handed the running sum as a sink.
+            template<typename Rng, typename T, typename Op, typename P>
+            static T impl(Rng &rng, T init, Op op, P proj, std::true_type)
+            {
+                push_fn<T, Op, P> push{init, op, proj};
+                ranges::for_each_while(rng, push);
+                return init;
+            }
+
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T unseq_impl(I begin, S end, T init, Op op, P proj, std::false_type)
+            {
+                return accumulate_fn{}(std::move(begin), std::move(end), std::move(init),
+                    std::move(op), std::move(proj));
+            }
+#if RANGES_HAVE_X86_SIMD
+            template<typename E>
+            static E fold(E const *p, std::size_t n, plus)
+            {
+                return detail::simd::sum(p, n);
+            }
+            template<typename E>
+            static E fold(E const *p, std::size_t n, multiplies)
+            {
+                return detail::simd::product(p, n);
+            }
+            // Sums and products of contiguous floats and doubles.
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T unseq_impl(I begin, S end, T init, Op op, P, std::true_type)
+            {
+                auto const n = end - begin;
+                if(n <= 0)
+                    return init;
+                return op(init, accumulate_fn::fold(detail::contiguous_data(begin),
+                    static_cast<std::size_t>(n), op));
+            }
+#endif
+
+        public:
             template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I, S>() && Accumulateable<I, T, Op, P>())>
             T operator()(I begin, S end, T init, Op op_ = Op{}, P proj_ = P{}) const
@@ -54,7 +118,32 @@ namespace ranges
                 CONCEPT_REQUIRES_(Iterable<Rng>() && Accumulateable<I, T, Op, P>())>
             T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
+                return accumulate_fn::impl(rng, std::move(init), std::move(op), std::move(proj),
+                    detail::is_pushable<Rng>{});
+            }
+
+            /// With \c unseq, \c op may be applied to the elements in any order and
+            /// grouping. Sums and products of contiguous ranges of \c float or
+            /// \c double into the same type are computed with vector instructions,
+            /// several vectors of partial results at a time. Other folds are done
+            /// in order, as without \c unseq.
+            template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && Accumulateable<I, T, Op, P>())>
+            T operator()(unsequenced_policy const &, I begin, S end, T init, Op op = Op{},
+                P proj = P{}) const
+            {
+                return accumulate_fn::unseq_impl(std::move(begin), std::move(end),
+                    std::move(init), std::move(op), std::move(proj),
+                    detail::simd_foldable<I, S, T, Op, P>{});
+            }
+
+            template<typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Iterable<Rng>() && Accumulateable<I, T, Op, P>())>
+            T operator()(unsequenced_policy const &policy, Rng && rng, T init, Op op = Op{},
+                P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(init), std::move(op),
                     std::move(proj));
             }
         };
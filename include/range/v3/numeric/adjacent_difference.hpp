@@ -17,6 +17,9 @@
 #ifndef RANGES_V3_NUMERIC_ADJACENT_DIFFERENCE_HPP
 #define RANGES_V3_NUMERIC_ADJACENT_DIFFERENCE_HPP
 
+#include <cstddef>
+#include <utility>
+#include <type_traits>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -24,6 +27,8 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/simd.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -43,14 +48,16 @@ namespace ranges
             CopyConstructible<X>,
             MoveAssignable<X>>;
 
+        /// Writes the first element of a range, then each element less the one
+        /// before it, to \c result, which may be the beginning of the range.
+        /// Differences of contiguous 32- or 64-bit integers, floats or doubles
+        /// are taken a vector register at a time.
         struct adjacent_difference_fn
         {
-            template <typename I, typename S, typename O, typename BOp = minus,
-                      typename P = ident,
-                      CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
-                                        AdjacentDifferentiable<I, O, BOp, P>())>
-            std::pair<I, O>
-            operator()(I begin, S end, O result, BOp bop_ = BOp{}, P proj_ = P{}) const
+        private:
+            template <typename I, typename S, typename O, typename BOp, typename P>
+            static std::pair<I, O>
+            impl(I begin, S end, O result, BOp bop_, P proj_, std::false_type)
             {
                 // BUGBUG think about the use of coerce here.
                 auto &&bop = invokable(bop_);
@@ -73,6 +80,36 @@ namespace ranges
                 }
                 return {begin, result};
             }
+#if RANGES_HAVE_X86_SIMD
+            template <typename I, typename S, typename O, typename BOp, typename P>
+            static std::pair<I, O>
+            impl(I begin, S end, O result, BOp, P, std::true_type)
+            {
+                auto const n = end - begin;
+                if(n != 0)
+                {
+                    auto const p = detail::contiguous_data(begin);
+                    auto const x = *p;
+                    *result = x;
+                    detail::simd::difference(p + 1, detail::contiguous_data(result) + 1,
+                                             static_cast<std::size_t>(n - 1), x);
+                }
+                return {begin + n, result + n};
+            }
+#endif
+        public:
+            template <typename I, typename S, typename O, typename BOp = minus,
+                      typename P = ident,
+                      CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
+                                        AdjacentDifferentiable<I, O, BOp, P>())>
+            std::pair<I, O>
+            operator()(I begin, S end, O result, BOp bop = BOp{}, P proj = P{}) const
+            {
+                using simd_t = detail::simd_differentiable<I, S, O, BOp, P>;
+                return adjacent_difference_fn::impl(std::move(begin), std::move(end),
+                                                    std::move(result), std::move(bop),
+                                                    std::move(proj), simd_t{});
+            }
 
             template <typename I, typename S, typename O, typename S2,
                       typename BOp = minus, typename P = ident,
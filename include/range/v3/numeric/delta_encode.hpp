@@ -0,0 +1,117 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_DELTA_ENCODE_HPP
+#define RANGES_V3_NUMERIC_DELTA_ENCODE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/simd.hpp>
+#include <range/v3/utility/varint.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I, typename O, typename V = iterator_value_t<I>>
+        using DeltaEncodable = meta::fast_and<
+            InputIterator<I>,
+            meta::bool_<detail::is_delta_codable<V>::value>,
+            WeakOutputIterator<O, std::uint8_t>>;
+
+        /// Writes each element of a range of integers less the one before it (the
+        /// first less 0) as a varint: seven bits to a byte, low bits first, with
+        /// the top bit set on all bytes but the last. Differences of signed types
+        /// are zigzagged, so that -1 is written as 1 and 1 as 2. A sorted column of
+        /// ids that are mostly less than 128 apart takes a byte each.
+        /// `view::delta_decode<T>` reads them back.
+        ///
+        /// Contiguous 32- and 64-bit integers are differenced a block at a time by
+        /// the same vector kernel as \c adjacent_difference.
+        struct delta_encode_fn
+        {
+        private:
+            template<typename I, typename S, typename O>
+            static std::pair<I, O> impl(I begin, S end, O out, std::false_type)
+            {
+                using V = iterator_value_t<I>;
+                V prev = 0;
+                for(; begin != end; ++begin)
+                {
+                    V const v = *begin;
+                    out = detail::varint_write(detail::delta_of(v, prev), std::move(out));
+                    prev = v;
+                }
+                return {begin, out};
+            }
+#if RANGES_HAVE_X86_SIMD
+            template<typename I, typename S, typename O>
+            static std::pair<I, O> impl(I begin, S end, O out, std::true_type)
+            {
+                using V = iterator_value_t<I>;
+                constexpr std::size_t block = 256;
+                auto const n = static_cast<std::size_t>(end - begin);
+                V const *p = n != 0 ? detail::contiguous_data(begin) : nullptr;
+                V diffs[block];
+                V prev = 0;
+                for(std::size_t i = 0; i != n;)
+                {
+                    std::size_t const m = n - i < block ? n - i : block;
+                    detail::simd::difference(p + i, diffs, m, prev);
+                    prev = p[i + m - 1];
+                    for(std::size_t j = 0; j != m; ++j)
+                        out = detail::varint_write(detail::delta_of(diffs[j], V(0)),
+                            std::move(out));
+                    i += m;
+                }
+                return {begin + static_cast<iterator_difference_t<I>>(n), out};
+            }
+#endif
+        public:
+            template<typename I, typename S, typename O,
+                typename V = iterator_value_t<I>,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && DeltaEncodable<I, O>())>
+            std::pair<I, O> operator()(I begin, S end, O out) const
+            {
+                return delta_encode_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    detail::simd_differentiable<I, S, V *, minus>{});
+            }
+
+            template<typename Rng, typename ORef, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>() && DeltaEncodable<I, O>())>
+            std::pair<I, O> operator()(Rng &rng, ORef &&out) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(out));
+            }
+        };
+
+        /// \sa `delta_encode_fn`
+        namespace
+        {
+            constexpr auto&& delta_encode = static_const<delta_encode_fn>::value;
+        }
+    }
+}
+
+#endif
@@ -14,11 +14,18 @@
 #ifndef RANGES_V3_NUMERIC_INNER_PRODUCT_HPP
 #define RANGES_V3_NUMERIC_INNER_PRODUCT_HPP
 
+#include <cstddef>
+#include <utility>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/reduce.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/simd.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -45,8 +52,69 @@ namespace ranges
             Invokable<BOp1, T, Y2>,
             Assignable<T &, Y2>>;
 
+        template<typename I1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                typename V1 = iterator_value_t<I1>,
+                typename V2 = iterator_value_t<I2>,
+                typename X1 = concepts::Invokable::result_t<P1, V1>,
+                typename X2 = concepts::Invokable::result_t<P2, V2>,
+                typename Y2 = concepts::Invokable::result_t<BOp2, X1, X2>,
+                typename Y = concepts::Invokable::result_t<BOp1, T, T>>
+        using ParallelInnerProductable = meta::fast_and<
+            ForwardIterator<I1>,
+            ForwardIterator<I2>,
+            InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>,
+            Constructible<T, Y2>,
+            Invokable<BOp1, T, T>,
+            Assignable<T &, Y>>;
+
+        /// The overloads taking \c par as their first argument split the work across
+        /// threads as \c reduce does, and \c bop1 must likewise be associative.
+        ///
+        /// With \c unseq, the products may be added in any order and grouping. Dot
+        /// products of contiguous ranges of \c float or \c double into the same
+        /// type are computed with vector instructions, several vectors of partial
+        /// sums at a time, and with fused multiply-adds where the CPU has them. The
+        /// ranges must be sized.
         struct inner_product_fn
         {
+        private:
+            template<typename I1, typename I2, typename D, typename T, typename BOp1,
+                typename BOp2, typename P1, typename P2>
+            static T parallel_impl(parallel_policy const &policy, I1 begin1, I2 begin2, D n,
+                T init, BOp1 &bop1, BOp2 &bop2, P1 &proj1, P2 &proj2)
+            {
+                detail::reduce_reader2<BOp2, P1, P2> read{bop2, proj1, proj2};
+                return detail::parallel_fold_n(detail::concurrency(policy),
+                    std::make_pair(std::move(begin1), std::move(begin2)), n, std::move(init),
+                    bop1, read);
+            }
+
+            template<typename I1, typename I2, typename D, typename T, typename BOp1,
+                typename BOp2, typename P1, typename P2>
+            static T unseq_impl(I1 begin1, I2 begin2, D n, T init, BOp1 bop1, BOp2 bop2,
+                P1 proj1, P2 proj2, std::false_type)
+            {
+                auto const end1 = ranges::next(begin1, n);
+                return inner_product_fn{}(std::move(begin1), end1, std::move(begin2),
+                    std::move(init), std::move(bop1), std::move(bop2), std::move(proj1),
+                    std::move(proj2));
+            }
+#if RANGES_HAVE_X86_SIMD
+            // Dot products of contiguous floats and doubles.
+            template<typename I1, typename I2, typename D, typename T, typename BOp1,
+                typename BOp2, typename P1, typename P2>
+            static T unseq_impl(I1 begin1, I2 begin2, D n, T init, BOp1, BOp2, P1, P2,
+                std::true_type)
+            {
+                if(n <= 0)
+                    return init;
+                return init + detail::simd::dot(detail::contiguous_data(begin1),
+                    detail::contiguous_data(begin2), static_cast<std::size_t>(n));
+            }
+#endif
+        public:
             template<typename I1, typename S1, typename I2, typename T,
                 typename BOp1 = plus, typename BOp2 = multiplies,
                 typename P1 = ident, typename P2 = ident,
@@ -118,6 +186,88 @@ namespace ranges
                 return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(init),
                     std::move(bop1), std::move(bop2),  std::move(proj1), std::move(proj2));
             }
+
+            template<typename I1, typename S1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    IteratorRange<I1, S1>() &&
+                    ParallelInnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(parallel_policy const &policy, I1 begin1, S1 end1, I2 begin2, T init,
+                BOp1 bop1_ = BOp1{}, BOp2 bop2_ = BOp2{}, P1 proj1_ = P1{},
+                P2 proj2_ = P2{}) const
+            {
+                auto &&bop1 = invokable(bop1_);
+                auto &&bop2 = invokable(bop2_);
+                auto &&proj1 = invokable(proj1_);
+                auto &&proj2 = invokable(proj2_);
+                auto const n = distance(begin1, end1);
+                return inner_product_fn::parallel_impl(policy, std::move(begin1),
+                    std::move(begin2), n, std::move(init), bop1, bop2, proj1, proj2);
+            }
+
+            template<typename Rng1, typename Rng2, typename T, typename BOp1 = plus,
+                typename BOp2 = multiplies, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+                CONCEPT_REQUIRES_(
+                    Iterable<Rng1>() &&
+                    Iterable<Rng2>() &&
+                    ParallelInnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(parallel_policy const &policy, Rng1 && rng1, Rng2 && rng2, T init,
+                BOp1 bop1_ = BOp1{}, BOp2 bop2_ = BOp2{}, P1 proj1_ = P1{},
+                P2 proj2_ = P2{}) const
+            {
+                auto &&bop1 = invokable(bop1_);
+                auto &&bop2 = invokable(bop2_);
+                auto &&proj1 = invokable(proj1_);
+                auto &&proj2 = invokable(proj2_);
+                auto const n1 = distance(rng1);
+                auto const n2 = distance(rng2);
+                return inner_product_fn::parallel_impl(policy, begin(rng1), begin(rng2),
+                    n1 < n2 ? n1 : static_cast<decltype(n1)>(n2), std::move(init), bop1, bop2,
+                    proj1, proj2);
+            }
+
+            template<typename I1, typename S1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    SizedIteratorRange<I1, S1>() &&
+                    InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(unsequenced_policy const &, I1 begin1, S1 end1, I2 begin2, T init,
+                BOp1 bop1 = BOp1{}, BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                auto const n = end1 - begin1;
+                return inner_product_fn::unseq_impl(std::move(begin1), std::move(begin2), n,
+                    std::move(init), std::move(bop1), std::move(bop2), std::move(proj1),
+                    std::move(proj2),
+                    detail::simd_dottable<I1, S1, I2, T, BOp1, BOp2, P1, P2>{});
+            }
+
+            template<typename Rng1, typename Rng2, typename T, typename BOp1 = plus,
+                typename BOp2 = multiplies, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+                CONCEPT_REQUIRES_(
+                    SizedIterable<Rng1>() &&
+                    SizedIterable<Rng2>() &&
+                    InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(unsequenced_policy const &, Rng1 && rng1, Rng2 && rng2, T init,
+                BOp1 bop1 = BOp1{}, BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                auto const n1 = distance(rng1);
+                auto const n2 = distance(rng2);
+                return inner_product_fn::unseq_impl(begin(rng1), begin(rng2),
+                    n1 < n2 ? n1 : static_cast<decltype(n1)>(n2), std::move(init),
+                    std::move(bop1), std::move(bop2), std::move(proj1), std::move(proj2),
+                    detail::simd_dottable<I1, range_sentinel_t<Rng1>, I2, T, BOp1, BOp2, P1,
+                        P2>{});
+            }
         };
 
         namespace
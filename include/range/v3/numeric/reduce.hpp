@@ -0,0 +1,300 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_REDUCE_HPP
+#define RANGES_V3_NUMERIC_REDUCE_HPP
+
+#include <future>
+#include <vector>
+#include <utility>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Below this many elements a thread, starting the thread costs more than
+            // it saves.
+            constexpr std::ptrdiff_t parallel_reduce_grain = 1 << 14;
+
+            // Reads proj(*it) off an iterator.
+            template<typename P>
+            struct reduce_reader
+            {
+                P &proj_;
+                template<typename I>
+                auto operator()(I const &it) const ->
+                    decltype(std::declval<P &>()(*it))
+                {
+                    return proj_(*it);
+                }
+                template<typename I>
+                static void next(I &it)
+                {
+                    ++it;
+                }
+                template<typename I, typename D>
+                static void advance(I &it, D n)
+                {
+                    ranges::advance(it, n);
+                }
+            };
+
+            // Reads fun(proj1(*it1), proj2(*it2)) off a pair of iterators that move
+            // in step.
+            template<typename Fun, typename P1, typename P2>
+            struct reduce_reader2
+            {
+                Fun &fun_;
+                P1 &proj1_;
+                P2 &proj2_;
+                template<typename I1, typename I2>
+                auto operator()(std::pair<I1, I2> const &its) const ->
+                    decltype(std::declval<Fun &>()(std::declval<P1 &>()(*its.first),
+                        std::declval<P2 &>()(*its.second)))
+                {
+                    return fun_(proj1_(*its.first), proj2_(*its.second));
+                }
+                template<typename I1, typename I2>
+                static void next(std::pair<I1, I2> &its)
+                {
+                    ++its.first;
+                    ++its.second;
+                }
+                template<typename I1, typename I2, typename D>
+                static void advance(std::pair<I1, I2> &its, D n)
+                {
+                    ranges::advance(its.first, n);
+                    ranges::advance(its.second, n);
+                }
+            };
+
+            template<typename Pos, typename D, typename T, typename Op, typename Read>
+            T fold_n(Pos pos, D n, T init, Op &op, Read &read)
+            {
+                for(; n != 0; --n, read.next(pos))
+                    init = op(std::move(init), read(pos));
+                return init;
+            }
+
+            // Folds the n elements from pos into init. The elements are cut into as
+            // many consecutive pieces as there are threads to spare; each piece but
+            // the first is folded on its own thread starting from its first element,
+            // and the partial results are then folded together in order. So op must
+            // be associative, but needn't be commutative.
+            template<typename Pos, typename D, typename T, typename Op, typename Read>
+            T parallel_fold_n(unsigned threads, Pos pos, D n, T init, Op &op, Read &read)
+            {
+                D const most = n / static_cast<D>(parallel_reduce_grain);
+                D const pieces = static_cast<D>(threads) < most ?
+                    static_cast<D>(threads) : most;
+                if(pieces <= 1)
+                    return detail::fold_n(std::move(pos), n, std::move(init), op, read);
+
+                std::vector<std::future<T>> parts;
+                parts.reserve(static_cast<std::size_t>(pieces - 1));
+                D const len0 = n / pieces + (n % pieces != 0 ? 1 : 0);
+                Pos it = pos;
+                read.advance(it, len0);
+                for(D k = 1; k != pieces; ++k)
+                {
+                    D const len = n / pieces + (k < n % pieces ? 1 : 0);
+                    parts.push_back(std::async(std::launch::async, [=, &op, &read]
+                    {
+                        Pos first = it;
+                        T part(read(first));
+                        read.next(first);
+                        return detail::fold_n(std::move(first), len - 1, std::move(part),
+                            op, read);
+                    }));
+                    read.advance(it, len);
+                }
+                // Should this throw, the futures wait for their threads as they are
+                // destroyed.
+                init = detail::fold_n(std::move(pos), len0, std::move(init), op, read);
+                for(auto &part : parts)
+                    init = op(std::move(init), part.get());
+                return init;
+            }
+        }
+        /// \endcond
+
+        template<typename I, typename T, typename Op = plus, typename P = ident,
+            typename V = iterator_value_t<I>,
+            typename X = concepts::Invokable::result_t<P, V>,
+            typename Y = concepts::Invokable::result_t<Op, T, T>>
+        using ParallelReduceable = meta::fast_and<
+            ForwardIterator<I>,
+            Accumulateable<I, T, Op, P>,
+            Constructible<T, X>,
+            Invokable<Op, T, T>,
+            Assignable<T &, Y>>;
+
+        /// Folds the elements of a range into \c init with \c op, like \c accumulate.
+        ///
+        /// The overloads taking \c par as their first argument cut a forward range
+        /// into consecutive pieces and fold them on separate threads. Each piece is
+        /// folded starting from its first element, and the partial results are
+        /// folded together in order; so \c op must be associative, but needn't be
+        /// commutative. \c init is folded in only once. \c op and \c proj are
+        /// called concurrently. A range that isn't sized is walked once first to
+        /// count it, and each thread's starting point is found by walking for
+        /// ranges that aren't random access; use those only when \c op is costly.
+        struct reduce_fn
+        {
+            template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && Accumulateable<I, T, Op, P>())>
+            T operator()(I begin, S end, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return accumulate(std::move(begin), std::move(end), std::move(init),
+                    std::move(op), std::move(proj));
+            }
+
+            template<typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Iterable<Rng>() && Accumulateable<I, T, Op, P>())>
+            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return accumulate(rng, std::move(init), std::move(op), std::move(proj));
+            }
+
+            template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && ParallelReduceable<I, T, Op, P>())>
+            T operator()(parallel_policy const &policy, I begin, S end, T init, Op op_ = Op{},
+                P proj_ = P{}) const
+            {
+                auto &&op = invokable(op_);
+                auto &&proj = invokable(proj_);
+                detail::reduce_reader<meta::eval<std::remove_reference<decltype(proj)>>>
+                    read{proj};
+                auto const n = distance(begin, end);
+                return detail::parallel_fold_n(detail::concurrency(policy), std::move(begin), n,
+                    std::move(init), op, read);
+            }
+
+            template<typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Iterable<Rng>() && ParallelReduceable<I, T, Op, P>())>
+            T operator()(parallel_policy const &policy, Rng && rng, T init, Op op_ = Op{},
+                P proj_ = P{}) const
+            {
+                auto &&op = invokable(op_);
+                auto &&proj = invokable(proj_);
+                detail::reduce_reader<meta::eval<std::remove_reference<decltype(proj)>>>
+                    read{proj};
+                return detail::parallel_fold_n(detail::concurrency(policy), begin(rng),
+                    distance(rng), std::move(init), op, read);
+            }
+        };
+
+        /// \sa `reduce_fn`
+        namespace
+        {
+            constexpr auto&& reduce = static_const<with_braced_init_args<reduce_fn>>::value;
+        }
+
+        /// Folds `fun(proj(x))` for each element \c x of a range into \c init with
+        /// \c op. With \c par, the work is split across threads as for \c reduce,
+        /// with the same requirements on \c op; \c fun is called concurrently too.
+        struct transform_reduce_fn
+        {
+        private:
+            template<typename Fun, typename P>
+            struct compose
+            {
+                Fun &fun_;
+                P &proj_;
+                template<typename V>
+                auto operator()(V &&v) const ->
+                    decltype(std::declval<Fun &>()(std::declval<P &>()(std::forward<V>(v))))
+                {
+                    return fun_(proj_(std::forward<V>(v)));
+                }
+            };
+        public:
+            template<typename I, typename S, typename T, typename Op, typename Fun,
+                typename P = ident,
+                typename F = invokable_t<Fun>, typename Q = invokable_t<P>,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
+                    Accumulateable<I, T, Op, compose<F, Q>>())>
+            T operator()(I begin, S end, T init, Op op, Fun fun_, P proj_ = P{}) const
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                return reduce(std::move(begin), std::move(end), std::move(init),
+                    std::move(op), compose<F, Q>{fun, proj});
+            }
+
+            template<typename Rng, typename T, typename Op, typename Fun, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename F = invokable_t<Fun>, typename Q = invokable_t<P>,
+                CONCEPT_REQUIRES_(Iterable<Rng>() && Accumulateable<I, T, Op, compose<F, Q>>())>
+            T operator()(Rng && rng, T init, Op op, Fun fun_, P proj_ = P{}) const
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                return reduce(rng, std::move(init), std::move(op), compose<F, Q>{fun, proj});
+            }
+
+            template<typename I, typename S, typename T, typename Op, typename Fun,
+                typename P = ident,
+                typename F = invokable_t<Fun>, typename Q = invokable_t<P>,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
+                    ParallelReduceable<I, T, Op, compose<F, Q>>())>
+            T operator()(parallel_policy const &policy, I begin, S end, T init, Op op,
+                Fun fun_, P proj_ = P{}) const
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                return reduce(policy, std::move(begin), std::move(end), std::move(init),
+                    std::move(op), compose<F, Q>{fun, proj});
+            }
+
+            template<typename Rng, typename T, typename Op, typename Fun, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename F = invokable_t<Fun>, typename Q = invokable_t<P>,
+                CONCEPT_REQUIRES_(Iterable<Rng>() &&
+                    ParallelReduceable<I, T, Op, compose<F, Q>>())>
+            T operator()(parallel_policy const &policy, Rng && rng, T init, Op op,
+                Fun fun_, P proj_ = P{}) const
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                return reduce(policy, rng, std::move(init), std::move(op),
+                    compose<F, Q>{fun, proj});
+            }
+        };
+
+        /// \sa `transform_reduce_fn`
+        namespace
+        {
+            constexpr auto&& transform_reduce =
+                static_const<with_braced_init_args<transform_reduce_fn>>::value;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,254 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_REPRODUCIBLE_SUM_HPP
+#define RANGES_V3_NUMERIC_REPRODUCIBLE_SUM_HPP
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            constexpr std::ptrdiff_t reproducible_sum_block = 1024;
+            constexpr std::ptrdiff_t reproducible_sum_lanes = 8;
+            // Don't hand fewer than this many blocks to another thread.
+            constexpr std::ptrdiff_t reproducible_sum_grain = 16;
+        }
+        /// \endcond
+
+        template<typename I, typename P = ident,
+            typename V = iterator_value_t<I>,
+            typename X = concepts::Invokable::result_t<P, V>>
+        using ReproduciblySummable = meta::fast_and<
+            InputIterator<I>,
+            Invokable<P, V>,
+            std::is_arithmetic<meta::eval<std::decay<X>>>>;
+
+        /// Sums the elements of a range the same way every time. The elements are
+        /// taken in blocks of 1024; within a block, element \c i is added into the
+        /// <tt>i % 8</tt>th of eight running sums, which are then added in pairs.
+        /// The block sums are added up in a tree whose shape depends only on the
+        /// number of blocks: a perfect binary tree over the largest power of two of
+        /// them, plus the tree of the rest. The result is a function of the
+        /// elements alone, so it is the same bit for bit sequentially, with \c par
+        /// on any number of threads, and from run to run; the eight running sums
+        /// let the compiler keep a vector register of them, and the tree keeps
+        /// the rounding error from growing with the length as a left fold does.
+        ///
+        /// With \c par, the range must be random access and sized; subtrees of the
+        /// same tree are summed on separate threads, and \c proj is called
+        /// concurrently.
+        ///
+        /// This holds only if the compiler keeps to the order of the additions as
+        /// written, which \c -ffast-math and the like allow it not to.
+        struct reproducible_sum_fn
+        {
+        private:
+            template<typename X>
+            static X fold_lanes(X const (&acc)[detail::reproducible_sum_lanes])
+            {
+                return ((acc[0] + acc[1]) + (acc[2] + acc[3])) +
+                    ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+            }
+
+            // Sums the n (at most a block of) elements from it.
+            template<typename X, typename I, typename P>
+            static X sum_block(I it, std::ptrdiff_t n, P &proj)
+            {
+                X acc[detail::reproducible_sum_lanes] = {};
+                auto const lanes = detail::reproducible_sum_lanes;
+                std::ptrdiff_t i = 0;
+                for(; i + lanes <= n; i += lanes)
+                    for(std::ptrdiff_t j = 0; j != lanes; ++j)
+                        acc[j] += static_cast<X>(proj(it[i + j]));
+                for(std::ptrdiff_t j = 0; i != n; ++i, ++j)
+                    acc[j] += static_cast<X>(proj(it[i]));
+                return reproducible_sum_fn::fold_lanes(acc);
+            }
+
+            // As above, reading from an input iterator up to a block at a time.
+            // Returns the number of elements read.
+            template<typename X, typename I, typename S, typename P>
+            static std::ptrdiff_t sum_block(I &it, S const &end, P &proj, X &sum)
+            {
+                X acc[detail::reproducible_sum_lanes] = {};
+                std::ptrdiff_t n = 0;
+                for(; n != detail::reproducible_sum_block && it != end; ++n, ++it)
+                    acc[n % detail::reproducible_sum_lanes] += static_cast<X>(proj(*it));
+                sum = reproducible_sum_fn::fold_lanes(acc);
+                return n;
+            }
+
+            // The tree over nblocks blocks from block lo: when nblocks is a power of
+            // two, its halves; otherwise the largest power of two of them and the
+            // rest.
+            static std::ptrdiff_t split(std::ptrdiff_t nblocks)
+            {
+                std::ptrdiff_t m = 1;
+                while(m * 2 < nblocks)
+                    m *= 2;
+                return m;
+            }
+
+            template<typename X, typename I, typename P>
+            static X sum_tree(I begin, std::ptrdiff_t n, std::ptrdiff_t lo,
+                std::ptrdiff_t nblocks, unsigned threads, P &proj)
+            {
+                if(nblocks == 1)
+                {
+                    std::ptrdiff_t const first = lo * detail::reproducible_sum_block;
+                    std::ptrdiff_t const len = n - first < detail::reproducible_sum_block ?
+                        n - first : detail::reproducible_sum_block;
+                    return reproducible_sum_fn::sum_block<X>(begin + first, len, proj);
+                }
+                std::ptrdiff_t const m = reproducible_sum_fn::split(nblocks);
+                X left, right;
+                if(threads > 1 && nblocks >= 2 * detail::reproducible_sum_grain)
+                {
+                    unsigned const t = detail::split_threads(threads, m, nblocks - m);
+                    detail::parallel_invoke(
+                        [&]
+                        {
+                            left = reproducible_sum_fn::sum_tree<X>(begin, n, lo, m, t, proj);
+                        },
+                        [&]
+                        {
+                            right = reproducible_sum_fn::sum_tree<X>(begin, n, lo + m,
+                                nblocks - m, threads - t, proj);
+                        });
+                }
+                else
+                {
+                    left = reproducible_sum_fn::sum_tree<X>(begin, n, lo, m, 1, proj);
+                    right = reproducible_sum_fn::sum_tree<X>(begin, n, lo + m, nblocks - m,
+                        1, proj);
+                }
+                return left + right;
+            }
+
+            template<typename X, typename I, typename P>
+            static X sum_sized(I begin, std::ptrdiff_t n, unsigned threads, P &proj)
+            {
+                if(n == 0)
+                    return X{};
+                auto const block = detail::reproducible_sum_block;
+                return reproducible_sum_fn::sum_tree<X>(std::move(begin), n, 0,
+                    (n + block - 1) / block, threads, proj);
+            }
+
+            template<typename X, typename I, typename S, typename P>
+            static X impl(I begin, S end, P &proj, std::true_type)
+            {
+                auto const n = static_cast<std::ptrdiff_t>(end - begin);
+                return reproducible_sum_fn::sum_sized<X>(std::move(begin), n, 1, proj);
+            }
+            // The same tree, built as the blocks go by: a stack of perfect subtrees
+            // of decreasing size, merged like the carries of a binary counter.
+            template<typename X, typename I, typename S, typename P>
+            static X impl(I begin, S end, P &proj, std::false_type)
+            {
+                X sums[64];
+                int levels[64];
+                int k = 0;
+                X sum;
+                while(reproducible_sum_fn::sum_block(begin, end, proj, sum) != 0)
+                {
+                    int level = 0;
+                    for(; k != 0 && levels[k - 1] == level; --k, ++level)
+                        sum = sums[k - 1] + sum;
+                    sums[k] = sum;
+                    levels[k++] = level;
+                }
+                if(k == 0)
+                    return X{};
+                sum = sums[--k];
+                while(k != 0)
+                    sum = sums[--k] + sum;
+                return sum;
+            }
+
+        public:
+            template<typename I, typename S, typename P = ident,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && ReproduciblySummable<I, P>())>
+            X operator()(I begin, S end, P proj_ = P{}) const
+            {
+                auto &&proj = invokable(proj_);
+                return reproducible_sum_fn::impl<X>(std::move(begin), std::move(end), proj,
+                    meta::bool_<RandomAccessIterator<I>() && SizedIteratorRange<I, S>()>{});
+            }
+
+            template<typename Rng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(Iterable<Rng>() && ReproduciblySummable<I, P>())>
+            X operator()(Rng && rng, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(proj));
+            }
+
+            template<typename I, typename S, typename P = ident,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    ReproduciblySummable<I, P>())>
+            X operator()(parallel_policy const &policy, I begin, S end, P proj_ = P{}) const
+            {
+                auto &&proj = invokable(proj_);
+                auto const n = static_cast<std::ptrdiff_t>(end - begin);
+                return reproducible_sum_fn::sum_sized<X>(std::move(begin), n,
+                    detail::concurrency(policy), proj);
+            }
+
+            template<typename Rng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() && ReproduciblySummable<I, P>())>
+            X operator()(parallel_policy const &policy, Rng && rng, P proj_ = P{}) const
+            {
+                auto &&proj = invokable(proj_);
+                auto const n = static_cast<std::ptrdiff_t>(distance(rng));
+                return reproducible_sum_fn::sum_sized<X>(begin(rng), n, detail::concurrency(policy),
+                    proj);
+            }
+        };
+
+        /// \sa `reproducible_sum_fn`
+        namespace
+        {
+            constexpr auto&& reproducible_sum =
+                static_const<with_braced_init_args<reproducible_sum_fn>>::value;
+        }
+    }
+}
+
+#endif
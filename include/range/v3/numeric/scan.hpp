@@ -0,0 +1,409 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_SCAN_HPP
+#define RANGES_V3_NUMERIC_SCAN_HPP
+
+#include <future>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/simd.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Don't give a thread fewer elements than this.
+            constexpr std::ptrdiff_t parallel_scan_grain = 1 << 16;
+            // The elements a thread takes at a time: few enough that they are still
+            // in its cache when it comes back to write their running sums.
+            constexpr std::ptrdiff_t parallel_scan_block = 1 << 14;
+
+            // Writes the running fold of the n elements from in, starting from
+            // sum, to the n elements from out, which may be in. Returns the fold of
+            // them all.
+            template<bool Exclusive, typename I, typename D, typename O, typename T,
+                typename Op, typename P>
+            T scan_n(I in, D n, O out, T sum, Op &op, P &proj, std::false_type)
+            {
+                for(; n != 0; --n, ++in, ++out)
+                {
+                    if(Exclusive)
+                    {
+                        T t = sum;
+                        sum = op(sum, proj(*in));
+                        *out = std::move(t);
+                    }
+                    else
+                    {
+                        sum = op(sum, proj(*in));
+                        *out = sum;
+                    }
+                }
+                return sum;
+            }
+
+#if RANGES_HAVE_X86_SIMD
+            template<bool Exclusive, typename I, typename D, typename O, typename T,
+                typename Op, typename P>
+            T scan_n(I in, D n, O out, T sum, Op &, P &, std::true_type)
+            {
+                if(n == 0)
+                    return sum;
+                return simd::scan<Exclusive>(detail::contiguous_data(in),
+                    detail::contiguous_data(out), static_cast<std::size_t>(n), sum);
+            }
+#endif
+
+            // The three-phase scan, a round at a time. In each round, each thread
+            // folds its block of the round's elements; then, once all of them are
+            // done, scans its block again from the fold of everything before it.
+            // Each thread works out that starting point itself from the folds of
+            // the rounds so far, so there is one wait per round. The folds of
+            // consecutive rounds go in alternate halves of sums: a thread can only
+            // get to overwrite a round's folds after all have read them.
+            template<bool Exclusive, typename I, typename D, typename O, typename T,
+                typename Op, typename P, typename Simd>
+            T parallel_scan_n(unsigned threads, I in, D n, O out, T init, Op &op, P &proj,
+                Simd simd)
+            {
+                D const most = n / static_cast<D>(parallel_scan_grain);
+                D const t = static_cast<D>(threads) < most ? static_cast<D>(threads) : most;
+                if(t <= 1)
+                    return detail::scan_n<Exclusive>(std::move(in), n, std::move(out),
+                        std::move(init), op, proj, simd);
+
+                D const round = t * static_cast<D>(parallel_scan_block);
+                std::vector<optional<T>> sums(static_cast<std::size_t>(2 * t));
+                detail::barrier all(static_cast<unsigned>(t));
+                T total = init;
+                auto const run = [&](D k)
+                {
+                    T carry = init;
+                    for(D r = 0, first = 0; first != n; ++r)
+                    {
+                        D const m = n - first < round ? n - first : round;
+                        D const len = m / t + (k < m % t ? 1 : 0);
+                        D const at = first + k * (m / t) + (k < m % t ? k : m % t);
+                        optional<T> *const folds = &sums[static_cast<std::size_t>(
+                            (r % 2) * t)];
+                        if(len != 0)
+                        {
+                            I it = in + at;
+                            T sum(proj(*it));
+                            for(D i = 1; i != len; ++i)
+                                sum = op(sum, proj(*++it));
+                            folds[k] = std::move(sum);
+                        }
+                        else
+                            folds[k].reset();
+                        if(!all.wait())
+                            return;
+                        T sum = carry;
+                        for(D j = 0; j != k; ++j)
+                            if(folds[j])
+                                sum = op(sum, *folds[j]);
+                        detail::scan_n<Exclusive>(in + at, len,
+                            out + static_cast<iterator_difference_t<O>>(at), std::move(sum),
+                            op, proj, simd);
+                        for(D j = 0; j != t; ++j)
+                            if(folds[j])
+                                carry = op(carry, *folds[j]);
+                        first += m;
+                    }
+                    if(k == 0)
+                        total = std::move(carry);
+                };
+                auto const guarded = [&](D k)
+                {
+                    try
+                    {
+                        run(k);
+                    }
+                    catch(...)
+                    {
+                        all.abandon();
+                        throw;
+                    }
+                };
+
+                std::vector<std::future<void>> workers;
+                workers.reserve(static_cast<std::size_t>(t - 1));
+                try
+                {
+                    for(D k = 1; k != t; ++k)
+                        workers.push_back(std::async(std::launch::async, guarded, k));
+                    guarded(0);
+                }
+                catch(...)
+                {
+                    all.abandon();
+                    for(auto &w : workers)
+                        w.wait();
+                    throw;
+                }
+                for(auto &w : workers)
+                    w.get();
+                return total;
+            }
+        }
+        /// \endcond
+
+        template<typename I, typename O, typename T, typename BOp = plus, typename P = ident,
+            typename V = iterator_value_t<I>,
+            typename X = concepts::Invokable::result_t<P, V>,
+            typename Y = concepts::Invokable::result_t<BOp, T, X>>
+        using ExclusiveScannable = meta::fast_and<
+            InputIterator<I>,
+            WeakOutputIterator<O, T>,
+            Invokable<P, V>,
+            CopyConstructible<T>,
+            Invokable<BOp, T, X>,
+            Assignable<T &, Y>>;
+
+        template<typename I, typename S, typename O>
+        using ParallelScannable = meta::fast_and<
+            RandomAccessIterator<I>,
+            SizedIteratorRange<I, S>,
+            RandomAccessIterator<O>>;
+
+        /// Writes the running fold of a range with \c bop to \c result, as
+        /// \c partial_sum does: the first element, then it and the second, and so
+        /// on. \c result may be the beginning of the input.
+        ///
+        /// With \c par, the input and output must be random access, and the input
+        /// sized. The elements are taken in rounds of a block of 16K for each
+        /// thread; each thread folds its block, and then writes the running fold of
+        /// its block starting from the fold of all the blocks before it, while the
+        /// block is still in its cache. So \c bop must be associative; \c bop and
+        /// \c proj are called concurrently.
+        ///
+        /// Either way, running sums of contiguous 32- or 64-bit integers are
+        /// written by a kernel that sums a vector register at a time.
+        struct inclusive_scan_fn
+        {
+        private:
+            template<typename I, typename S, typename O, typename BOp, typename P>
+            static std::pair<I, O> impl(I begin, S end, O result, BOp bop, P proj,
+                std::false_type)
+            {
+                return partial_sum(std::move(begin), std::move(end), std::move(result),
+                    std::move(bop), std::move(proj));
+            }
+#if RANGES_HAVE_X86_SIMD
+            template<typename I, typename S, typename O, typename BOp, typename P>
+            static std::pair<I, O> impl(I begin, S end, O result, BOp bop, P proj,
+                std::true_type)
+            {
+                auto const n = end - begin;
+                if(n != 0)
+                {
+                    auto const x = *begin;
+                    *result = x;
+                    detail::scan_n<false>(begin + 1, n - 1, result + 1, x, bop, proj,
+                        std::true_type{});
+                }
+                return {begin + n, result + n};
+            }
+#endif
+        public:
+            template<typename I, typename S, typename O, typename BOp = plus,
+                typename P = ident,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && PartialSummable<I, O, BOp, P>())>
+            std::pair<I, O>
+            operator()(I begin, S end, O result, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return inclusive_scan_fn::impl(std::move(begin), std::move(end),
+                    std::move(result), std::move(bop), std::move(proj),
+                    detail::simd_scannable<I, S, O, X, BOp, P>{});
+            }
+
+            template<typename Rng, typename ORef, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>, typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>() && PartialSummable<I, O, BOp, P>())>
+            std::pair<I, O>
+            operator()(Rng &rng, ORef &&result, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(result),
+                    std::move(bop), std::move(proj));
+            }
+
+            template<typename I, typename S, typename O, typename BOp = plus,
+                typename P = ident,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(ParallelScannable<I, S, O>() &&
+                    PartialSummable<I, O, BOp, P>() && ParallelReduceable<I, X, BOp, P>())>
+            std::pair<I, O>
+            operator()(parallel_policy const &policy, I begin, S end, O result,
+                BOp bop_ = BOp{}, P proj_ = P{}) const
+            {
+                auto &&bop = invokable(bop_);
+                auto &&proj = invokable(proj_);
+                auto const n = end - begin;
+                if(n != 0)
+                {
+                    // The first element starts the fold.
+                    X x(proj(*begin));
+                    *result = x;
+                    detail::parallel_scan_n<false>(detail::concurrency(policy), begin + 1, n - 1,
+                        result + 1, std::move(x), bop, proj,
+                        detail::simd_scannable<I, S, O, X, BOp, P>{});
+                }
+                return {begin + n, result + static_cast<iterator_difference_t<O>>(n)};
+            }
+
+            template<typename Rng, typename ORef, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>, typename O = uncvref_t<ORef>,
+                typename X = meta::eval<std::decay<
+                    concepts::Invokable::result_t<P, iterator_value_t<I>>>>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>() &&
+                    ParallelScannable<I, range_sentinel_t<Rng>, O>() &&
+                    PartialSummable<I, O, BOp, P>() && ParallelReduceable<I, X, BOp, P>())>
+            std::pair<I, O>
+            operator()(parallel_policy const &policy, Rng &rng, ORef &&result,
+                BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::forward<ORef>(result),
+                    std::move(bop), std::move(proj));
+            }
+        };
+
+        /// \sa `inclusive_scan_fn`
+        namespace
+        {
+            constexpr auto&& inclusive_scan = static_const<inclusive_scan_fn>::value;
+        }
+
+        /// Writes the running fold of a range with \c bop, starting from \c init, to
+        /// \c result: \c init, then \c init and the first element, and so on, up
+        /// to but not including the last element. From \c init 0 and a range of
+        /// sizes, that is where each would start in an array of them all, as the
+        /// row offsets of a compressed sparse row matrix are. \c result may be the
+        /// beginning of the input. \c par and the vector kernel are as for
+        /// \c inclusive_scan.
+        struct exclusive_scan_fn
+        {
+        private:
+            template<typename I, typename S, typename O, typename T, typename BOp,
+                typename P>
+            static std::pair<I, O> impl(I begin, S end, O result, T init, BOp bop_,
+                P proj_, std::false_type)
+            {
+                auto &&bop = invokable(bop_);
+                auto &&proj = invokable(proj_);
+                for(; begin != end; ++begin, ++result)
+                {
+                    T t = init;
+                    init = bop(init, proj(*begin));
+                    *result = std::move(t);
+                }
+                return {begin, result};
+            }
+#if RANGES_HAVE_X86_SIMD
+            template<typename I, typename S, typename O, typename T, typename BOp,
+                typename P>
+            static std::pair<I, O> impl(I begin, S end, O result, T init, BOp bop, P proj,
+                std::true_type)
+            {
+                auto const n = end - begin;
+                detail::scan_n<true>(begin, n, result, init, bop, proj, std::true_type{});
+                return {begin + n, result + n};
+            }
+#endif
+        public:
+            template<typename I, typename S, typename O, typename T, typename BOp = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
+                    ExclusiveScannable<I, O, T, BOp, P>())>
+            std::pair<I, O>
+            operator()(I begin, S end, O result, T init, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return exclusive_scan_fn::impl(std::move(begin), std::move(end),
+                    std::move(result), std::move(init), std::move(bop), std::move(proj),
+                    detail::simd_scannable<I, S, O, T, BOp, P>{});
+            }
+
+            template<typename Rng, typename ORef, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>() && ExclusiveScannable<I, O, T, BOp, P>())>
+            std::pair<I, O>
+            operator()(Rng &rng, ORef &&result, T init, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(result),
+                    std::move(init), std::move(bop), std::move(proj));
+            }
+
+            template<typename I, typename S, typename O, typename T, typename BOp = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ParallelScannable<I, S, O>() &&
+                    ExclusiveScannable<I, O, T, BOp, P>() &&
+                    ParallelReduceable<I, T, BOp, P>())>
+            std::pair<I, O>
+            operator()(parallel_policy const &policy, I begin, S end, O result, T init,
+                BOp bop_ = BOp{}, P proj_ = P{}) const
+            {
+                auto &&bop = invokable(bop_);
+                auto &&proj = invokable(proj_);
+                auto const n = end - begin;
+                detail::parallel_scan_n<true>(detail::concurrency(policy), begin, n, result,
+                    std::move(init), bop, proj, detail::simd_scannable<I, S, O, T, BOp, P>{});
+                return {begin + n, result + static_cast<iterator_difference_t<O>>(n)};
+            }
+
+            template<typename Rng, typename ORef, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>() &&
+                    ParallelScannable<I, range_sentinel_t<Rng>, O>() &&
+                    ExclusiveScannable<I, O, T, BOp, P>() &&
+                    ParallelReduceable<I, T, BOp, P>())>
+            std::pair<I, O>
+            operator()(parallel_policy const &policy, Rng &rng, ORef &&result, T init,
+                BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::forward<ORef>(result),
+                    std::move(init), std::move(bop), std::move(proj));
+            }
+        };
+
+        /// \sa `exclusive_scan_fn`
+        namespace
+        {
+            constexpr auto&& exclusive_scan = static_const<exclusive_scan_fn>::value;
+        }
+    }
+}
+
+#endif
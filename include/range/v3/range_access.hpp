@@ -103,6 +103,25 @@ namespace ranges
                 return rng.end_adaptor();
             }
 
+            template<typename Rng, typename Fun>
+            static auto for_each_segment(Rng & rng, Fun & fun) ->
+                decltype(rng.for_each_segment(fun))
+            {
+                return rng.for_each_segment(fun);
+            }
+            template<typename Rng, typename Sink>
+            static auto for_each_while(Rng & rng, Sink & sink) ->
+                decltype(rng.for_each_while(sink))
+            {
+                return rng.for_each_while(sink);
+            }
+            template<typename Rng, typename Sink>
+            static auto for_each_block(Rng & rng, Sink & sink) ->
+                decltype(rng.for_each_block(sink))
+            {
+                return rng.for_each_block(sink);
+            }
+
             template<typename Cur>
             static auto current(Cur const &pos) noexcept(noexcept(pos.current())) ->
                 decltype(pos.current())
@@ -547,6 +547,14 @@ namespace ranges
             struct move_fn;
         }
 
+        template<typename Rng, typename Pred, bool Unseq = false>
+        struct remove_if_view;
+
+        namespace view
+        {
+            struct remove_if_fn;
+        }
+
         template<typename Val>
         struct repeat_view;
 
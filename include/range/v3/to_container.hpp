@@ -14,10 +14,13 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <algorithm>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/blocks.hpp>
 #include <range/v3/utility/common_iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -46,10 +49,144 @@ namespace ranges
                 Convertible<range_value_t<Rng>, range_value_t<Cont>>,
                 Constructible<Cont, I, I>>;
 
+            // Containers that can be grown one element at a time with the storage
+            // reserved up front, like std::vector and std::basic_string.
+            struct ReservableContainerConcept
+            {
+                template<typename Cont, typename T>
+                auto requires_(Cont c, T) -> decltype(
+                    concepts::valid_expr(
+                        concepts::model_of<concepts::DefaultConstructible, Cont>(),
+                        concepts::model_of<concepts::Integral>(c.capacity()),
+                        ((void)c.reserve(c.size()), 42),
+                        ((void)c.push_back(concepts::val<T>()), 42)
+                    ));
+            };
+
+            template<typename Cont, typename T>
+            using ReservableContainer = concepts::models<ReservableContainerConcept, Cont, T>;
+
+            struct reserve_exact_tag {};
+            struct reserve_chunked_tag {};
+            struct construct_tag {};
+
+            template<typename Cont>
+            struct push_back_fn
+            {
+                Cont &c_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    c_.push_back(std::forward<T>(t));
+                    return true;
+                }
+                template<typename T>
+                void operator()(T const *p, std::ptrdiff_t n) const
+                {
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        c_.push_back(p[i]);
+                }
+            };
+
+            template<typename Cont, typename Size>
+            struct push_back_chunked_fn
+            {
+                Cont &c_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    if(c_.size() == c_.capacity())
+                        c_.reserve(c_.capacity() + std::max<decltype(c_.size())>(c_.capacity(),
+                            Size::value));
+                    c_.push_back(std::forward<T>(t));
+                    return true;
+                }
+                template<typename T>
+                void operator()(T const *p, std::ptrdiff_t n) const
+                {
+                    auto const room = c_.capacity() - c_.size();
+                    if(room < static_cast<decltype(room)>(n))
+                        c_.reserve(c_.capacity() + std::max<decltype(c_.size())>(
+                            std::max<decltype(c_.size())>(c_.capacity(), Size::value),
+                            static_cast<decltype(c_.size())>(n)));
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        c_.push_back(p[i]);
+                }
+            };
+
             template<typename ContainerMetafunctionClass>
             struct to_container_fn
               : pipeable<to_container_fn<ContainerMetafunctionClass>>
             {
+            private:
+                // Pipelines with a filter in them hand the sink whole blocks.
+                template<typename Rng, typename Sink>
+                static void fill(Rng &rng, Sink sink, std::true_type)
+                {
+                    range_access::for_each_block(rng, sink);
+                }
+                template<typename Rng, typename Sink>
+                static void fill(Rng &rng, Sink sink, std::false_type)
+                {
+                    for_each_while(rng, sink);
+                }
+
+                // Growing in whole chunks skips the many tiny reallocations a container
+                // makes on its way up from empty.
+                template<typename Cont>
+                static constexpr std::size_t chunk_size()
+                {
+                    return 4096 / sizeof(range_value_t<Cont>) != 0 ?
+                        4096 / sizeof(range_value_t<Cont>) : 1;
+                }
+
+                // The size is known, so allocate exactly once.
+                template<typename Cont, typename Rng>
+                static Cont impl(Rng && rng, reserve_exact_tag)
+                {
+                    Cont c;
+                    c.reserve(static_cast<decltype(c.size())>(size(rng)));
+                    to_container_fn::fill(rng, push_back_fn<Cont>{c},
+                        use_blocks<Rng>{});
+                    return c;
+                }
+
+                // No size, and either single-pass or a view that drives its own
+                // loop: take it in chunks that at least double the capacity each
+                // time.
+                template<typename Cont, typename Rng>
+                static Cont impl(Rng && rng, reserve_chunked_tag)
+                {
+                    Cont c;
+                    to_container_fn::fill(rng, push_back_chunked_fn<Cont,
+                        meta::size_t<to_container_fn::chunk_size<Cont>()>>{c},
+                        use_blocks<Rng>{});
+                    return c;
+                }
+
+                // The container's range constructor measures forward ranges itself.
+                template<typename Cont, typename Rng>
+                static Cont impl(Rng && rng, construct_tag)
+                {
+                    using I = range_common_iterator_t<Rng>;
+                    return Cont{I{begin(rng)}, I{end(rng)}};
+                }
+
+                template<typename Rng, typename Cont>
+                using impl_tag =
+                    meta::if_<
+                        ReservableContainer<Cont, range_reference_t<Rng>>,
+                        meta::if_<
+                            SizedIterable<Rng>,
+                            reserve_exact_tag,
+                            meta::if_<
+                                meta::and_<
+                                    ForwardIterable<Rng>,
+                                    meta::not_<detail::is_pushable<Rng>>>,
+                                construct_tag,
+                                reserve_chunked_tag>>,
+                        construct_tag>;
+            public:
                 template<typename Rng,
                     typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
                     CONCEPT_REQUIRES_(Iterable<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
@@ -57,9 +194,7 @@ namespace ranges
                 {
                     static_assert(!is_infinite<Rng>::value,
                         "Attempt to convert an infinite range to a container.");
-                    using I = range_common_iterator_t<Rng>;
-                    // BUGBUG size may be known here, even though I may be an InputIterator
-                    return Cont{I{begin(rng)}, I{end(rng)}};
+                    return to_container_fn::impl<Cont>(rng, impl_tag<Rng, Cont>{});
                 }
             };
         }
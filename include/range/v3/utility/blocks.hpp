@@ -0,0 +1,71 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_BLOCKS_HPP
+#define RANGES_V3_UTILITY_BLOCKS_HPP
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The most elements a view stage holds in its buffer at a time.
+            constexpr std::ptrdiff_t block_size = 256;
+
+            template<typename T>
+            struct block_sink_archetype
+            {
+                void operator()(T const *, std::ptrdiff_t) const;
+            };
+
+            template<typename Rng, typename Enable = void>
+            struct has_for_each_block
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct has_for_each_block<Rng, void_t<decltype(range_access::for_each_block(
+                std::declval<Rng &>(),
+                std::declval<block_sink_archetype<range_value_t<Rng>> &>()))>>
+              : std::true_type
+            {};
+
+            // Whether some stage of the view drops elements. Stages that only map
+            // are fused by the compiler into a single loop that already
+            // vectorizes, so running them a block at a time only adds a pass
+            // through the buffer. Views specialize this on their own type.
+            template<typename Rng>
+            struct block_filters
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            using use_blocks = meta::and_<
+                has_for_each_block<Rng>,
+                block_filters<meta::eval<std::decay<Rng>>>>;
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,316 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_CONTIGUOUS_ITERATOR_HPP
+#define RANGES_V3_UTILITY_CONTIGUOUS_ITERATOR_HPP
+
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/simd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+
+// Non-portable forward declarations of the pointer wrappers that libstdc++ and
+// libc++ use as the iterators of std::vector and std::basic_string. With
+// other standard libraries, those containers are included to name their
+// iterators. std::array's iterators are pointers in both.
+#if !defined(RANGES_NO_STD_FORWARD_DECLARATIONS) && defined(__GLIBCXX__)
+namespace __gnu_cxx
+{
+    template<typename Iterator, typename Container>
+    class __normal_iterator;
+}
+#elif !defined(RANGES_NO_STD_FORWARD_DECLARATIONS) && defined(_LIBCPP_VERSION)
+RANGES_BEGIN_NAMESPACE_STD
+    template<class Iter>
+    class __wrap_iter;
+RANGES_END_NAMESPACE_STD
+#else
+#define RANGES_CONTIGUOUS_ITERATOR_USE_CONTAINERS
+#include <array>
+#include <string>
+#include <vector>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+#if !defined(RANGES_CONTIGUOUS_ITERATOR_USE_CONTAINERS)
+            template<typename I>
+            struct is_std_contiguous_iterator
+              : std::false_type
+            {};
+#endif
+
+#if !defined(RANGES_CONTIGUOUS_ITERATOR_USE_CONTAINERS) && defined(__GLIBCXX__)
+            template<typename T, typename Container>
+            struct is_std_contiguous_iterator<__gnu_cxx::__normal_iterator<T *, Container>>
+              : std::true_type
+            {};
+#elif !defined(RANGES_CONTIGUOUS_ITERATOR_USE_CONTAINERS)
+            template<typename T>
+            struct is_std_contiguous_iterator<std::__wrap_iter<T *>>
+              : std::true_type
+            {};
+#else
+            template<typename T>
+            using is_char_type = meta::or_<
+                std::is_same<T, char>, std::is_same<T, wchar_t>,
+                std::is_same<T, char16_t>, std::is_same<T, char32_t>>;
+
+            template<typename I, typename V>
+            using is_vector_iterator = meta::and_<
+                meta::not_<std::is_same<V, bool>>,
+                meta::or_<
+                    std::is_same<I, typename std::vector<V>::iterator>,
+                    std::is_same<I, typename std::vector<V>::const_iterator>>>;
+
+            // basic_string is only instantiated for character types.
+            template<typename I, typename V,
+                typename C = meta::if_<is_char_type<V>, V, char>>
+            using is_string_iterator = meta::and_<
+                is_char_type<V>,
+                meta::or_<
+                    std::is_same<I, typename std::basic_string<C>::iterator>,
+                    std::is_same<I, typename std::basic_string<C>::const_iterator>>>;
+
+            template<typename I, typename Enable = void>
+            struct is_std_contiguous_iterator
+              : std::false_type
+            {};
+
+            template<typename I>
+            struct is_std_contiguous_iterator<I, enable_if_t<
+                std::is_object<iterator_value_t<I>>::value &&
+                !std::is_abstract<iterator_value_t<I>>::value &&
+                !std::is_array<iterator_value_t<I>>::value, void>>
+              : meta::or_<
+                    is_vector_iterator<I, iterator_value_t<I>>,
+                    is_string_iterator<I, iterator_value_t<I>>,
+                    std::is_same<I, typename std::array<iterator_value_t<I>, 1>::iterator>,
+                    std::is_same<I, typename std::array<iterator_value_t<I>, 1>::const_iterator>>
+            {};
+#endif
+        }
+        /// \endcond
+
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Whether the objects an iterator refers to are adjacent in memory, so
+        /// that `std::addressof(*i) + n == std::addressof(*(i + n))`. True for
+        /// pointers and for the iterators of \c std::vector (except
+        /// `std::vector<bool>`), \c std::basic_string and \c std::array with the
+        /// default allocators. Specialize it for other contiguous iterators.
+        template<typename I>
+        struct is_contiguous_iterator
+          : meta::or_<std::is_pointer<I>, detail::is_std_contiguous_iterator<I>>
+        {};
+
+        /// Returns a range of pointers to the elements of a contiguous range.
+        template<typename I, typename S,
+            CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                              SizedIteratorRange<I, S>() &&
+                              is_contiguous_iterator<I>())>
+        range<meta::eval<std::remove_reference<iterator_reference_t<I>>> *>
+        as_contiguous_range(I begin, S end)
+        {
+            if(begin == end)
+                return {nullptr, nullptr};
+            else
+                return {std::addressof(*begin), std::addressof(*begin) + (end - begin)};
+        }
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            template<typename I, bool = is_contiguous_iterator<I>::value>
+            struct contiguous_element
+            {
+                using type = void;
+            };
+
+            template<typename I>
+            struct contiguous_element<I, true>
+            {
+                using type = meta::eval<std::remove_reference<iterator_reference_t<I>>>;
+            };
+
+            // The (possibly const) type of the objects a contiguous iterator refers
+            // to, or void if I isn't contiguous.
+            template<typename I>
+            using contiguous_element_t = meta::eval<contiguous_element<I>>;
+
+            template<typename I>
+            using contiguous_value_t =
+                meta::eval<std::remove_const<contiguous_element_t<I>>>;
+
+            // Comparing two objects of type T for equality is comparing their bytes.
+            template<typename T>
+            using is_bytewise_comparable = meta::or_<
+                std::is_integral<T>, std::is_enum<T>, std::is_pointer<T>>;
+
+            template<typename T, bool = std::is_integral<T>::value>
+            struct is_byte
+              : std::false_type
+            {};
+
+            template<typename T>
+            struct is_byte<T, true>
+              : meta::bool_<sizeof(T) == 1 && !std::is_same<T, bool>::value>
+            {};
+
+            // The elements of [I, S) can be copied to O with memmove.
+            template<typename I, typename S, typename O, typename P = ident>
+            using memmove_copyable = meta::bool_<
+                std::is_same<P, ident>::value &&
+                !std::is_void<contiguous_element_t<I>>::value &&
+                std::is_same<contiguous_value_t<I>, contiguous_element_t<O>>::value &&
+                !std::is_volatile<contiguous_element_t<O>>::value &&
+                std::is_trivially_copyable<contiguous_element_t<O>>::value &&
+                SizedIteratorRange<I, S>::value>;
+
+            // [I0, S0) and [I1, ...) hold the same arithmetic, enum or pointer type and
+            // are compared with ==.
+            template<typename I0, typename S0, typename I1, typename C, typename P0,
+                typename P1>
+            using contiguous_equatable = meta::bool_<
+                std::is_same<C, ranges::equal_to>::value &&
+                std::is_same<P0, ident>::value && std::is_same<P1, ident>::value &&
+                !std::is_void<contiguous_element_t<I0>>::value &&
+                std::is_same<contiguous_value_t<I0>, contiguous_value_t<I1>>::value &&
+                SizedIteratorRange<I0, S0>::value>;
+
+            // Compares [I0, S0) and [I1, ...) with memcmp.
+            template<typename I0, typename S0, typename I1, typename C, typename P0,
+                typename P1>
+            using memcmp_comparable = meta::bool_<
+                contiguous_equatable<I0, S0, I1, C, P0, P1>::value &&
+                is_bytewise_comparable<contiguous_value_t<I0>>::value>;
+
+            // Compares [I0, S0) and [I1, ...) with simd::mismatch.
+            template<typename I0, typename S0, typename I1, typename C, typename P0,
+                typename P1>
+            using simd_comparable = meta::bool_<
+                contiguous_equatable<I0, S0, I1, C, P0, P1>::value &&
+                is_simd_lane<contiguous_value_t<I0>>::value>;
+
+            // The elements of [I, S) are bytes that can be scanned with memchr or
+            // set with memset.
+            template<typename I, typename S, typename P = ident>
+            using contiguous_bytes = meta::bool_<
+                std::is_same<P, ident>::value &&
+                !std::is_void<contiguous_element_t<I>>::value &&
+                is_byte<contiguous_value_t<I>>::value &&
+                SizedIteratorRange<I, S>::value>;
+
+            // Elements of [I, S) can be compared with a V by the simd:: kernels (or
+            // memchr), after converting the V to the element type.
+            template<typename I, typename S, typename V, typename P = ident,
+                typename E = contiguous_value_t<I>>
+            using simd_countable = meta::bool_<
+                std::is_same<P, ident>::value &&
+                is_simd_lane<E>::value &&
+                (std::is_same<E, V>::value ||
+                    (std::is_integral<E>::value && std::is_integral<V>::value)) &&
+                SizedIteratorRange<I, S>::value>;
+
+            template<typename I, typename S, typename V, typename P = ident>
+            using contiguous_searchable = meta::bool_<
+                (contiguous_bytes<I, S, P>::value && std::is_integral<V>::value) ||
+                simd_countable<I, S, V, P>::value>;
+
+            // e == val after the usual arithmetic conversions, with the conversions
+            // spelled out so that comparing across signedness doesn't warn. E and V
+            // are integers, or the same type.
+            template<typename E, typename V>
+            bool same_value(E e, V const &val)
+            {
+                using C = meta::eval<std::common_type<E, V>>;
+                return static_cast<C>(e) == static_cast<C>(val);
+            }
+
+            // [I, S) holds float or double T and folding it with Op, which is plus
+            // or multiplies, can be done by the simd:: kernels.
+            template<typename I, typename S, typename T, typename Op, typename P = ident,
+                typename E = contiguous_value_t<I>>
+            using simd_foldable = meta::bool_<
+                std::is_same<P, ident>::value &&
+                (std::is_same<Op, plus>::value || std::is_same<Op, multiplies>::value) &&
+                std::is_floating_point<E>::value && is_simd_lane<E>::value &&
+                std::is_same<E, T>::value &&
+                SizedIteratorRange<I, S>::value>;
+
+            // The sum of products of [I0, S0) and [I1, ...) into a T can be computed
+            // by simd::dot.
+            template<typename I0, typename S0, typename I1, typename T, typename Op0,
+                typename Op1, typename P0, typename P1, typename E = contiguous_value_t<I0>>
+            using simd_dottable = meta::bool_<
+                simd_foldable<I0, S0, T, Op0, P0>::value &&
+                std::is_same<Op0, plus>::value && std::is_same<Op1, multiplies>::value &&
+                std::is_same<P1, ident>::value &&
+                std::is_same<contiguous_value_t<I1>, E>::value>;
+
+            template<typename T, bool = std::is_integral<T>::value>
+            struct is_simd_scan_lane
+              : std::false_type
+            {};
+
+            template<typename T>
+            struct is_simd_scan_lane<T, true>
+              : meta::bool_<is_simd_lane<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)>
+            {};
+
+            // [I, S) holds 32- or 64-bit integers whose running sums from a T of the
+            // same type can be written to O by simd::scan.
+            template<typename I, typename S, typename O, typename T, typename Op,
+                typename P = ident, typename E = contiguous_value_t<I>>
+            using simd_scannable = meta::bool_<
+                std::is_same<P, ident>::value && std::is_same<Op, plus>::value &&
+                is_simd_scan_lane<E>::value &&
+                std::is_same<E, T>::value && std::is_same<contiguous_element_t<O>, E>::value &&
+                SizedIteratorRange<I, S>::value>;
+
+            // [I, S) holds 32- or 64-bit integers, floats or doubles whose
+            // differences with Op can be written to O by simd::difference.
+            template<typename I, typename S, typename O, typename Op, typename P = ident,
+                typename E = contiguous_value_t<I>>
+            using simd_differentiable = meta::bool_<
+                std::is_same<P, ident>::value && std::is_same<Op, minus>::value &&
+                (is_simd_scan_lane<E>::value ||
+                    (std::is_floating_point<E>::value && is_simd_lane<E>::value)) &&
+                std::is_same<contiguous_element_t<O>, E>::value &&
+                SizedIteratorRange<I, S>::value>;
+
+            template<typename I>
+            contiguous_element_t<I> *contiguous_data(I const &it)
+            {
+                return std::addressof(*it);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#undef RANGES_CONTIGUOUS_ITERATOR_USE_CONTAINERS
+
+#endif
@@ -0,0 +1,579 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_DFA_PATTERN_HPP
+#define RANGES_V3_UTILITY_DFA_PATTERN_HPP
+
+#include <map>
+#include <bitset>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A compiled pattern. Bytes that the pattern never tells apart share a
+            // class, and each state has one transition per class. State 0 is dead
+            // and state 1 is the start.
+            struct dfa_tables
+            {
+                static constexpr std::uint32_t dead = 0;
+                static constexpr std::uint32_t start = 1;
+
+                std::uint8_t classes[256];
+                std::size_t nclasses;
+                std::vector<std::uint32_t> next;
+                std::vector<char> accepting;
+
+                std::uint32_t transition(std::uint32_t s, char c) const
+                {
+                    return next[s * nclasses + classes[static_cast<unsigned char>(c)]];
+                }
+                bool accepts(std::uint32_t s) const
+                {
+                    return accepting[s] != 0;
+                }
+                bool can_start(char c) const
+                {
+                    return transition(start, c) != dead;
+                }
+                // The end of the longest match beginning at first, or first.
+                template<typename I, typename S>
+                I match(I first, S last) const
+                {
+                    std::uint32_t const *const tbl = next.data();
+                    std::uint8_t const *const cls = classes;
+                    char const *const acc = accepting.data();
+                    std::size_t const n = nclasses;
+                    std::uint32_t s = start;
+                    I end = first;
+                    while(first != last)
+                    {
+                        s = tbl[s * n + cls[static_cast<unsigned char>(*first)]];
+                        if(s == dead)
+                            break;
+                        ++first;
+                        if(acc[s])
+                            end = first;
+                    }
+                    return end;
+                }
+            };
+
+            // Builds the DFA directly from the syntax tree by way of followpos, as in
+            // Aho, Sethi and Ullman, "Compilers", section 3.9.
+            struct dfa_compiler
+            {
+            private:
+                enum kind_t { empty_k, leaf_k, cat_k, alt_k, star_k };
+                struct node
+                {
+                    kind_t kind;
+                    int lhs, rhs;
+                    std::bitset<256> set;
+                };
+                using position_set = std::vector<int>;
+
+                static constexpr int max_repeat = 1000;
+                static constexpr std::size_t max_states = 1u << 16;
+
+                std::string pat_;
+                std::size_t pos_;
+                std::vector<node> nodes_;
+
+                [[noreturn]] void error(char const *what) const
+                {
+                    throw std::invalid_argument(std::string("dfa_pattern: ") + what +
+                        " at offset " + std::to_string(pos_) + " in \"" + pat_ + "\"");
+                }
+                bool at_end() const
+                {
+                    return pos_ == pat_.size();
+                }
+                char peek() const
+                {
+                    return pat_[pos_];
+                }
+                int make(kind_t kind, int lhs = -1, int rhs = -1)
+                {
+                    nodes_.push_back(node{kind, lhs, rhs, {}});
+                    return static_cast<int>(nodes_.size() - 1);
+                }
+                int leaf(std::bitset<256> const &set)
+                {
+                    int n = make(leaf_k);
+                    nodes_[static_cast<std::size_t>(n)].set = set;
+                    return n;
+                }
+                int cat(int lhs, int rhs)
+                {
+                    return lhs < 0 ? rhs : make(cat_k, lhs, rhs);
+                }
+                // Repetition needs copies of a subexpression with positions of their own.
+                int clone(int n)
+                {
+                    node const nd = nodes_[static_cast<std::size_t>(n)];
+                    int const lhs = nd.lhs < 0 ? -1 : clone(nd.lhs);
+                    int const rhs = nd.rhs < 0 ? -1 : clone(nd.rhs);
+                    int const c = make(nd.kind, lhs, rhs);
+                    nodes_[static_cast<std::size_t>(c)].set = nd.set;
+                    return c;
+                }
+
+                static std::bitset<256> char_set(char c)
+                {
+                    std::bitset<256> s;
+                    s.set(static_cast<unsigned char>(c));
+                    return s;
+                }
+                static std::bitset<256> range_set(int lo, int hi)
+                {
+                    std::bitset<256> s;
+                    for(int c = lo; c <= hi; ++c)
+                        s.set(static_cast<std::size_t>(c));
+                    return s;
+                }
+                static std::bitset<256> space_set()
+                {
+                    return char_set(' ') | range_set('\t', '\r');
+                }
+                static std::bitset<256> word_set()
+                {
+                    return range_set('a', 'z') | range_set('A', 'Z') | range_set('0', '9') |
+                        char_set('_');
+                }
+                static int hex_value(char c)
+                {
+                    return c >= '0' && c <= '9' ? c - '0' :
+                        c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                        c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+                }
+
+                // The character after a backslash.
+                std::bitset<256> parse_escape()
+                {
+                    if(at_end())
+                        error("trailing backslash");
+                    char const c = pat_[pos_++];
+                    switch(c)
+                    {
+                    case 'd': return range_set('0', '9');
+                    case 'D': return ~range_set('0', '9');
+                    case 'w': return word_set();
+                    case 'W': return ~word_set();
+                    case 's': return space_set();
+                    case 'S': return ~space_set();
+                    case 'n': return char_set('\n');
+                    case 'r': return char_set('\r');
+                    case 't': return char_set('\t');
+                    case 'f': return char_set('\f');
+                    case 'v': return char_set('\v');
+                    case '0': return char_set('\0');
+                    case 'x':
+                    {
+                        int const hi = pos_ + 2 <= pat_.size() ? hex_value(pat_[pos_]) : -1;
+                        int const lo = hi < 0 ? -1 : hex_value(pat_[pos_ + 1]);
+                        if(lo < 0)
+                            error("expected two hex digits after \\x");
+                        pos_ += 2;
+                        return range_set(hi * 16 + lo, hi * 16 + lo);
+                    }
+                    default:
+                        if((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                           (c >= '0' && c <= '9'))
+                            error("unsupported escape");
+                        return char_set(c);
+                    }
+                }
+                // A bracket expression, after the '['.
+                std::bitset<256> parse_class()
+                {
+                    bool const negate = !at_end() && peek() == '^';
+                    pos_ += negate;
+                    std::bitset<256> set;
+                    while(!at_end() && peek() != ']')
+                    {
+                        if(peek() == '\\')
+                        {
+                            ++pos_;
+                            std::bitset<256> const s = parse_escape();
+                            // A lone character may still begin a range.
+                            if(s.count() != 1 || at_end() || peek() != '-')
+                            {
+                                set |= s;
+                                continue;
+                            }
+                            int lo = 0;
+                            while(!s[static_cast<std::size_t>(lo)])
+                                ++lo;
+                            set |= parse_range(lo);
+                            continue;
+                        }
+                        set |= parse_range(static_cast<unsigned char>(pat_[pos_++]));
+                    }
+                    if(at_end())
+                        error("unterminated character class");
+                    ++pos_;
+                    return negate ? ~set : set;
+                }
+                // lo, possibly followed by "-hi".
+                std::bitset<256> parse_range(int lo)
+                {
+                    if(pos_ + 1 >= pat_.size() || peek() != '-' || pat_[pos_ + 1] == ']')
+                        return range_set(lo, lo);
+                    ++pos_;
+                    int hi;
+                    if(peek() == '\\')
+                    {
+                        ++pos_;
+                        std::bitset<256> const s = parse_escape();
+                        if(s.count() != 1)
+                            error("invalid character range");
+                        hi = 0;
+                        while(!s[static_cast<std::size_t>(hi)])
+                            ++hi;
+                    }
+                    else
+                        hi = static_cast<unsigned char>(pat_[pos_++]);
+                    if(hi < lo)
+                        error("invalid character range");
+                    return range_set(lo, hi);
+                }
+                int parse_atom()
+                {
+                    char const c = pat_[pos_++];
+                    switch(c)
+                    {
+                    case '(':
+                    {
+                        if(pat_.compare(pos_, 2, "?:") == 0)
+                            pos_ += 2;
+                        int const n = parse_alt();
+                        if(at_end())
+                            error("missing ')'");
+                        ++pos_;
+                        return n;
+                    }
+                    case '[':
+                        return leaf(parse_class());
+                    case '.':
+                        return leaf(~char_set('\n'));
+                    case '\\':
+                        return leaf(parse_escape());
+                    case '*': case '+': case '?': case '{':
+                        --pos_;
+                        error("nothing to repeat");
+                    case '^': case '$':
+                        --pos_;
+                        error("anchors are not supported");
+                    default:
+                        return leaf(char_set(c));
+                    }
+                }
+                int parse_count()
+                {
+                    if(at_end() || peek() < '0' || peek() > '9')
+                        error("expected a repetition count");
+                    int n = 0;
+                    while(!at_end() && peek() >= '0' && peek() <= '9')
+                    {
+                        n = n * 10 + (pat_[pos_++] - '0');
+                        if(n > max_repeat)
+                            error("repetition count too large");
+                    }
+                    return n;
+                }
+                // {n}, {n,} or {n,m}, after the '{'.
+                int parse_bounds(int n)
+                {
+                    int const lo = parse_count();
+                    int hi = lo;
+                    bool unbounded = false;
+                    if(!at_end() && peek() == ',')
+                    {
+                        ++pos_;
+                        if(!at_end() && peek() == '}')
+                            unbounded = true;
+                        else
+                            hi = parse_count();
+                    }
+                    if(at_end() || peek() != '}')
+                        error("expected '}'");
+                    ++pos_;
+                    if(hi < lo)
+                        error("invalid repetition bounds");
+                    int r = -1;
+                    bool used = false;
+                    auto next_copy = [&]
+                    {
+                        int const c = used ? clone(n) : n;
+                        used = true;
+                        return c;
+                    };
+                    for(int i = 0; i < lo; ++i)
+                        r = cat(r, next_copy());
+                    if(unbounded)
+                        r = cat(r, make(star_k, next_copy()));
+                    else
+                        for(int i = lo; i < hi; ++i)
+                            r = cat(r, make(alt_k, next_copy(), make(empty_k)));
+                    return r < 0 ? make(empty_k) : r;
+                }
+                int parse_repeat()
+                {
+                    int n = parse_atom();
+                    while(!at_end())
+                    {
+                        switch(peek())
+                        {
+                        case '*':
+                            ++pos_;
+                            n = make(star_k, n);
+                            break;
+                        case '+':
+                            ++pos_;
+                            n = make(cat_k, n, make(star_k, clone(n)));
+                            break;
+                        case '?':
+                            ++pos_;
+                            n = make(alt_k, n, make(empty_k));
+                            break;
+                        case '{':
+                            ++pos_;
+                            n = parse_bounds(n);
+                            break;
+                        default:
+                            return n;
+                        }
+                    }
+                    return n;
+                }
+                int parse_cat()
+                {
+                    int n = -1;
+                    while(!at_end() && peek() != '|' && peek() != ')')
+                        n = cat(n, parse_repeat());
+                    return n < 0 ? make(empty_k) : n;
+                }
+                int parse_alt()
+                {
+                    int n = parse_cat();
+                    while(!at_end() && peek() == '|')
+                    {
+                        ++pos_;
+                        n = make(alt_k, n, parse_cat());
+                    }
+                    return n;
+                }
+
+                static void merge(position_set &to, position_set const &from)
+                {
+                    position_set r;
+                    r.reserve(to.size() + from.size());
+                    std::set_union(to.begin(), to.end(), from.begin(), from.end(),
+                        std::back_inserter(r));
+                    to.swap(r);
+                }
+            public:
+                explicit dfa_compiler(std::string pattern)
+                  : pat_(std::move(pattern)), pos_(0)
+                {}
+                std::shared_ptr<dfa_tables> compile()
+                {
+                    int root = parse_alt();
+                    if(!at_end())
+                        error("unmatched ')'");
+                    // The end marker: a position that matches nothing.
+                    int const accept = make(leaf_k);
+                    root = make(cat_k, root, accept);
+
+                    // Children always come before their parents.
+                    std::size_t const size = nodes_.size();
+                    std::vector<char> nullable(size);
+                    std::vector<position_set> first(size), last(size), follow(size);
+                    for(std::size_t i = 0; i < size; ++i)
+                    {
+                        node const &nd = nodes_[i];
+                        std::size_t const l = static_cast<std::size_t>(nd.lhs);
+                        std::size_t const r = static_cast<std::size_t>(nd.rhs);
+                        switch(nd.kind)
+                        {
+                        case empty_k:
+                            nullable[i] = true;
+                            break;
+                        case leaf_k:
+                            first[i] = last[i] = position_set{static_cast<int>(i)};
+                            break;
+                        case alt_k:
+                            nullable[i] = nullable[l] || nullable[r];
+                            first[i] = first[l];
+                            merge(first[i], first[r]);
+                            last[i] = last[l];
+                            merge(last[i], last[r]);
+                            break;
+                        case cat_k:
+                            nullable[i] = nullable[l] && nullable[r];
+                            first[i] = first[l];
+                            if(nullable[l])
+                                merge(first[i], first[r]);
+                            last[i] = last[r];
+                            if(nullable[r])
+                                merge(last[i], last[l]);
+                            for(int p : last[l])
+                                merge(follow[static_cast<std::size_t>(p)], first[r]);
+                            break;
+                        case star_k:
+                            nullable[i] = true;
+                            first[i] = first[l];
+                            last[i] = last[l];
+                            for(int p : last[l])
+                                merge(follow[static_cast<std::size_t>(p)], first[l]);
+                            break;
+                        }
+                    }
+
+                    auto tables = std::make_shared<dfa_tables>();
+
+                    // Split the bytes into classes that no leaf tells apart.
+                    std::vector<int> cls(256, 0);
+                    std::size_t nclasses = 1;
+                    for(node const &nd : nodes_)
+                    {
+                        if(nd.kind != leaf_k)
+                            continue;
+                        std::vector<int> remap(2 * nclasses, -1);
+                        std::size_t m = 0;
+                        for(std::size_t b = 0; b < 256; ++b)
+                        {
+                            int &id = remap[2 * static_cast<std::size_t>(cls[b]) + nd.set[b]];
+                            if(id < 0)
+                                id = static_cast<int>(m++);
+                            cls[b] = id;
+                        }
+                        nclasses = m;
+                    }
+                    std::vector<std::size_t> representative(nclasses);
+                    for(std::size_t b = 256; b-- != 0;)
+                    {
+                        tables->classes[b] = static_cast<std::uint8_t>(cls[b]);
+                        representative[static_cast<std::size_t>(cls[b])] = b;
+                    }
+                    tables->nclasses = nclasses;
+
+                    // The subset construction, with the empty set as the dead state.
+                    std::map<position_set, std::uint32_t> ids;
+                    std::vector<position_set> states;
+                    auto id_of = [&](position_set s)
+                    {
+                        auto it = ids.find(s);
+                        if(it != ids.end())
+                            return it->second;
+                        if(states.size() == max_states)
+                            error("pattern needs too many states");
+                        auto const id = static_cast<std::uint32_t>(states.size());
+                        ids.emplace(s, id);
+                        states.push_back(std::move(s));
+                        return id;
+                    };
+                    id_of(position_set{});
+                    id_of(first[static_cast<std::size_t>(root)]);
+                    for(std::size_t i = 0; i < states.size(); ++i)
+                    {
+                        position_set const state = states[i];
+                        tables->accepting.push_back(
+                            std::binary_search(state.begin(), state.end(), accept));
+                        for(std::size_t c = 0; c < nclasses; ++c)
+                        {
+                            position_set to;
+                            for(int p : state)
+                                if(nodes_[static_cast<std::size_t>(p)].set[representative[c]])
+                                    merge(to, follow[static_cast<std::size_t>(p)]);
+                            tables->next.push_back(id_of(std::move(to)));
+                        }
+                    }
+                    return tables;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-utility
+        /// @{
+
+        /// A pattern compiled to a table-driven DFA over bytes, for use with
+        /// \c view::tokenize. It supports literals, `.`, bracket expressions,
+        /// the escapes `\d \w \s \D \W \S \n \r \t \f \v \0 \xHH`, grouping,
+        /// alternation, and the repetitions `* + ? {n} {n,} {n,m}`. Anchors,
+        /// captures and back-references are not supported, and an invalid
+        /// pattern throws \c std::invalid_argument.
+        ///
+        /// Matching is leftmost-longest, as in POSIX, rather than ECMAScript's
+        /// leftmost-first; for the usual tokenizer patterns the two agree.
+        /// Copies share the compiled tables.
+        struct dfa_pattern
+        {
+        private:
+            template<typename Rng>
+            friend struct dfa_tokenize_view;
+            std::shared_ptr<detail::dfa_tables const> tables_;
+        public:
+            dfa_pattern() = default;
+            explicit dfa_pattern(std::string pattern)
+              : tables_(detail::dfa_compiler{std::move(pattern)}.compile())
+            {}
+            explicit dfa_pattern(char const *pattern)
+              : dfa_pattern(std::string(pattern))
+            {}
+            /// The number of states in the compiled DFA, including the dead state.
+            std::size_t state_count() const
+            {
+                return tables_->accepting.size();
+            }
+            /// Whether some non-empty match begins with \c c.
+            bool can_start(char c) const
+            {
+                return tables_->can_start(c);
+            }
+            /// The end of the longest match that begins at \c first, or \c first if
+            /// no non-empty prefix of [first, last) matches.
+            template<typename I, typename S>
+            I match(I first, S last) const
+            {
+                return tables_->match(std::move(first), std::move(last));
+            }
+            /// Whether all of [first, last) matches.
+            template<typename I, typename S>
+            bool full_match(I first, S last) const
+            {
+                std::uint32_t s = detail::dfa_tables::start;
+                for(; first != last && s != detail::dfa_tables::dead; ++first)
+                    s = tables_->transition(s, *first);
+                return tables_->accepts(s);
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,88 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_EXECUTION_POLICY_HPP
+#define RANGES_V3_UTILITY_EXECUTION_POLICY_HPP
+
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Execution policy requesting that an algorithm split its work across
+        /// several threads. The predicates and projections passed along with it
+        /// are invoked concurrently and must be safe to call that way.
+        struct parallel_policy
+        {
+        private:
+            unsigned threads_;
+        public:
+            constexpr parallel_policy()
+              : threads_(0)
+            {}
+            constexpr explicit parallel_policy(unsigned threads)
+              : threads_(threads)
+            {}
+            /// Returns a policy that uses at most \c threads threads; 0 means
+            /// "as many as the hardware supports".
+            constexpr parallel_policy operator()(unsigned threads) const
+            {
+                return parallel_policy{threads};
+            }
+            /// The most threads to use, or 0 for as many as the hardware
+            /// supports.
+            constexpr unsigned threads() const
+            {
+                return threads_;
+            }
+        };
+
+        /// Execution policy allowing an algorithm to combine the elements in any
+        /// order and grouping, so that it can keep several partial results at once
+        /// in the lanes of vector registers. The operations must be associative and
+        /// commutative; floating-point results may round differently from those
+        /// of the sequential algorithm.
+        struct unsequenced_policy
+        {};
+
+        template<typename T>
+        struct is_execution_policy
+          : std::false_type
+        {};
+
+        template<>
+        struct is_execution_policy<parallel_policy>
+          : std::true_type
+        {};
+
+        template<>
+        struct is_execution_policy<unsequenced_policy>
+          : std::true_type
+        {};
+
+        /// \ingroup group-utility
+        namespace
+        {
+            constexpr auto&& par = static_const<parallel_policy>::value;
+            constexpr auto&& unseq = static_const<unsequenced_policy>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
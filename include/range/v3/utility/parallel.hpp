@@ -0,0 +1,113 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_PARALLEL_HPP
+#define RANGES_V3_UTILITY_PARALLEL_HPP
+
+#include <mutex>
+#include <future>
+#include <thread>
+#include <condition_variable>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/execution_policy.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The number of threads policy allows.
+            inline unsigned concurrency(parallel_policy const &policy)
+            {
+                return policy.threads() != 0 ? policy.threads() :
+                    (std::thread::hardware_concurrency() != 0 ?
+                        std::thread::hardware_concurrency() : 1u);
+            }
+
+            // Runs f on a new thread and g on the calling one, and waits for both.
+            // An exception thrown by either is rethrown after both have finished.
+            template<typename F, typename G>
+            void parallel_invoke(F f, G g)
+            {
+                auto fut = std::async(std::launch::async, std::move(f));
+                try
+                {
+                    g();
+                }
+                catch(...)
+                {
+                    fut.wait();
+                    throw;
+                }
+                fut.get();
+            }
+
+            // Holds each of a fixed number of threads at wait() until all of them
+            // have got there. Once abandoned, as by a thread that can't get there,
+            // every wait() returns false at once.
+            struct barrier
+            {
+            private:
+                std::mutex mutex_;
+                std::condition_variable cv_;
+                unsigned const count_;
+                unsigned waiting_;
+                unsigned long phase_;
+                bool broken_;
+            public:
+                explicit barrier(unsigned count)
+                  : count_(count), waiting_(0), phase_(0), broken_(false)
+                {}
+                bool wait()
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    if(broken_)
+                        return false;
+                    if(++waiting_ == count_)
+                    {
+                        waiting_ = 0;
+                        ++phase_;
+                        cv_.notify_all();
+                        return true;
+                    }
+                    auto const phase = phase_;
+                    cv_.wait(lock, [&] { return phase_ != phase || broken_; });
+                    return phase_ != phase;
+                }
+                void abandon()
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    broken_ = true;
+                    cv_.notify_all();
+                }
+            };
+
+            // Divides a budget of threads between two subproblems in proportion to
+            // their sizes, leaving at least one thread for each.
+            template<typename D>
+            unsigned split_threads(unsigned threads, D left, D right)
+            {
+                RANGES_ASSERT(threads > 1);
+                auto const total = static_cast<double>(left) + static_cast<double>(right);
+                auto n = total == 0 ? threads / 2 :
+                    static_cast<unsigned>(threads * (static_cast<double>(left) / total) + 0.5);
+                return n < 1 ? 1 : (n > threads - 1 ? threads - 1 : n);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,74 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_SEGMENTED_HPP
+#define RANGES_V3_UTILITY_SEGMENTED_HPP
+
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/utility/meta.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A segmented range is a sequence of inner ranges laid end to end, like
+            // the result of view::join or view::concat. It makes that structure
+            // visible to algorithms with a member, called through range_access,
+            //
+            //     template<typename Fun>
+            //     range_iterator_t<Rng> for_each_segment(Fun &fun);
+            //
+            // which calls fun(it, end) for each inner range in turn, with `it` an
+            // lvalue iterator to the beginning of the inner range. fun either
+            // advances `it` to `end` and returns false to go on to the next segment,
+            // or returns true to stop with `it` at some position before `end`. The
+            // result is the range's iterator to that position, or to its end.
+            //
+            // The algorithms then run their own loop over each segment, and the
+            // "is this inner range exhausted?" bookkeeping happens once per segment
+            // instead of once per element.
+            struct segment_visitor_archetype
+            {
+                template<typename I, typename S>
+                bool operator()(I &, S) const;
+            };
+
+            template<typename Rng, typename Enable = void>
+            struct is_segmented
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_segmented<Rng, void_t<decltype(range_access::for_each_segment(
+                std::declval<Rng &>(), std::declval<segment_visitor_archetype &>()))>>
+              : std::true_type
+            {};
+
+            template<typename Rng, typename Fun>
+            auto for_each_segment(Rng &rng, Fun &fun) ->
+                decltype(range_access::for_each_segment(rng, fun))
+            {
+                return range_access::for_each_segment(rng, fun);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,699 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_SIMD_HPP
+#define RANGES_V3_UTILITY_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+
+#if RANGES_HAVE_X86_SIMD
+#include <immintrin.h>
+#define RANGES_SIMD_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define RANGES_SIMD_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Whether the simd:: kernels handle objects of type T. They compare with
+            // the semantics of ==, so -0.0 matches 0.0 and NaN matches nothing.
+            template<typename T, bool = RANGES_HAVE_X86_SIMD &&
+                std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+            struct is_simd_lane
+              : std::false_type
+            {};
+
+            template<typename T>
+            struct is_simd_lane<T, true>
+              : meta::bool_<std::is_integral<T>::value ?
+                    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) :
+                    (sizeof(T) == 4 || sizeof(T) == 8)>
+            {};
+
+#if RANGES_HAVE_X86_SIMD
+            namespace simd
+            {
+                template<std::size_t N>
+                struct int_tag {};
+                struct f32_tag {};
+                struct f64_tag {};
+
+                template<typename T>
+                using lane_tag = meta::if_<std::is_floating_point<T>,
+                    meta::if_c<sizeof(T) == 4, f32_tag, f64_tag>, int_tag<sizeof(T)>>;
+
+                // a + b and a - b, wrapping around for integers as the vector
+                // instructions do.
+                template<typename T>
+                T wrap_add(T a, T b, std::true_type)
+                {
+                    using U = meta::eval<std::make_unsigned<T>>;
+                    return static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+                }
+                template<typename T>
+                T wrap_add(T a, T b, std::false_type)
+                {
+                    return a + b;
+                }
+                template<typename T>
+                T wrap_sub(T a, T b, std::true_type)
+                {
+                    using U = meta::eval<std::make_unsigned<T>>;
+                    return static_cast<T>(static_cast<U>(a) - static_cast<U>(b));
+                }
+                template<typename T>
+                T wrap_sub(T a, T b, std::false_type)
+                {
+                    return a - b;
+                }
+
+                // Each comparison returns one bit per byte of the vector, so an
+                // element of size k that compares equal sets k adjacent bits.
+                struct sse2
+                {
+                    using vec = __m128i;
+                    static constexpr std::size_t width = 16;
+                    static constexpr std::uint32_t all = 0xffffu;
+
+                    static vec load(void const *p)
+                    {
+                        return _mm_loadu_si128(static_cast<__m128i const *>(p));
+                    }
+                    template<typename T>
+                    static vec splat(T v)
+                    {
+                        T buf[width / sizeof(T)];
+                        for(T &t : buf)
+                            t = v;
+                        return sse2::load(buf);
+                    }
+                    static std::uint32_t mask(vec v)
+                    {
+                        return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+                    }
+                    static std::uint32_t eq(vec a, vec b, int_tag<1>)
+                    {
+                        return sse2::mask(_mm_cmpeq_epi8(a, b));
+                    }
+                    static std::uint32_t eq(vec a, vec b, int_tag<2>)
+                    {
+                        return sse2::mask(_mm_cmpeq_epi16(a, b));
+                    }
+                    static std::uint32_t eq(vec a, vec b, int_tag<4>)
+                    {
+                        return sse2::mask(_mm_cmpeq_epi32(a, b));
+                    }
+                    // No 64-bit compare before SSE4.1: both 32-bit halves must match.
+                    static std::uint32_t eq(vec a, vec b, int_tag<8>)
+                    {
+                        vec const c = _mm_cmpeq_epi32(a, b);
+                        return sse2::mask(_mm_and_si128(c,
+                            _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1))));
+                    }
+                    static std::uint32_t eq(vec a, vec b, f32_tag)
+                    {
+                        return sse2::mask(_mm_castps_si128(
+                            _mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))));
+                    }
+                    static std::uint32_t eq(vec a, vec b, f64_tag)
+                    {
+                        return sse2::mask(_mm_castpd_si128(
+                            _mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))));
+                    }
+
+                    // Integer arithmetic wraps around, so it is exact in any order.
+                    static void store(void *p, vec v)
+                    {
+                        _mm_storeu_si128(static_cast<__m128i *>(p), v);
+                    }
+                    static vec add(vec a, vec b, int_tag<4>) { return _mm_add_epi32(a, b); }
+                    static vec add(vec a, vec b, int_tag<8>) { return _mm_add_epi64(a, b); }
+                    static vec sub(vec a, vec b, int_tag<4>) { return _mm_sub_epi32(a, b); }
+                    static vec sub(vec a, vec b, int_tag<8>) { return _mm_sub_epi64(a, b); }
+                    static vec sub(vec a, vec b, f32_tag)
+                    {
+                        return _mm_castps_si128(
+                            _mm_sub_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                    }
+                    static vec sub(vec a, vec b, f64_tag)
+                    {
+                        return _mm_castpd_si128(
+                            _mm_sub_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                    }
+                    // The last Size bytes of prev followed by all but the last Size
+                    // bytes of cur: each element of cur's predecessor.
+                    template<int Size>
+                    static vec shift_in(vec prev, vec cur)
+                    {
+                        return _mm_or_si128(_mm_slli_si128(cur, Size),
+                            _mm_srli_si128(prev, 16 - Size));
+                    }
+                    // The running sums of the elements of v, by adding v to itself
+                    // shifted up by one element, then by two, and so on.
+                    static vec prefix(vec v, int_tag<4>)
+                    {
+                        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+                        return _mm_add_epi32(v, _mm_slli_si128(v, 8));
+                    }
+                    static vec prefix(vec v, int_tag<8>)
+                    {
+                        return _mm_add_epi64(v, _mm_slli_si128(v, 8));
+                    }
+                    // The last element of v in every element.
+                    static vec last(vec v, int_tag<4>)
+                    {
+                        return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+                    }
+                    static vec last(vec v, int_tag<8>)
+                    {
+                        return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 2, 3, 2));
+                    }
+                };
+
+                struct avx2
+                {
+                    using vec = __m256i;
+                    static constexpr std::size_t width = 32;
+                    static constexpr std::uint32_t all = 0xffffffffu;
+
+                    RANGES_SIMD_TARGET_AVX2 static vec load(void const *p)
+                    {
+                        return _mm256_loadu_si256(static_cast<__m256i const *>(p));
+                    }
+                    template<typename T>
+                    RANGES_SIMD_TARGET_AVX2 static vec splat(T v)
+                    {
+                        T buf[width / sizeof(T)];
+                        for(T &t : buf)
+                            t = v;
+                        return avx2::load(buf);
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t mask(vec v)
+                    {
+                        return static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t eq(vec a, vec b, int_tag<1>)
+                    {
+                        return avx2::mask(_mm256_cmpeq_epi8(a, b));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t eq(vec a, vec b, int_tag<2>)
+                    {
+                        return avx2::mask(_mm256_cmpeq_epi16(a, b));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t eq(vec a, vec b, int_tag<4>)
+                    {
+                        return avx2::mask(_mm256_cmpeq_epi32(a, b));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t eq(vec a, vec b, int_tag<8>)
+                    {
+                        return avx2::mask(_mm256_cmpeq_epi64(a, b));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t eq(vec a, vec b, f32_tag)
+                    {
+                        return avx2::mask(_mm256_castps_si256(_mm256_cmp_ps(
+                            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ)));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static std::uint32_t eq(vec a, vec b, f64_tag)
+                    {
+                        return avx2::mask(_mm256_castpd_si256(_mm256_cmp_pd(
+                            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ)));
+                    }
+
+                    RANGES_SIMD_TARGET_AVX2 static void store(void *p, vec v)
+                    {
+                        _mm256_storeu_si256(static_cast<__m256i *>(p), v);
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec add(vec a, vec b, int_tag<4>)
+                    {
+                        return _mm256_add_epi32(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec add(vec a, vec b, int_tag<8>)
+                    {
+                        return _mm256_add_epi64(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec sub(vec a, vec b, int_tag<4>)
+                    {
+                        return _mm256_sub_epi32(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec sub(vec a, vec b, int_tag<8>)
+                    {
+                        return _mm256_sub_epi64(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec sub(vec a, vec b, f32_tag)
+                    {
+                        return _mm256_castps_si256(
+                            _mm256_sub_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec sub(vec a, vec b, f64_tag)
+                    {
+                        return _mm256_castpd_si256(
+                            _mm256_sub_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+                    }
+                    // alignr shifts within each 128-bit half, so each half of cur is
+                    // paired with the half before it: prev's high half, or cur's low.
+                    template<int Size>
+                    RANGES_SIMD_TARGET_AVX2 static vec shift_in(vec prev, vec cur)
+                    {
+                        return _mm256_alignr_epi8(cur,
+                            _mm256_permute2x128_si256(prev, cur, 0x21), 16 - Size);
+                    }
+                    // Byte shifts stay within each 128-bit half, so each half is
+                    // summed on its own and the last sum of the low half is then
+                    // added to all of the high half.
+                    RANGES_SIMD_TARGET_AVX2 static vec prefix(vec v, int_tag<4>)
+                    {
+                        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+                        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+                        vec const low = _mm256_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+                        return _mm256_add_epi32(v, _mm256_permute2x128_si256(low, low, 0x08));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec prefix(vec v, int_tag<8>)
+                    {
+                        v = _mm256_add_epi64(v, _mm256_slli_si256(v, 8));
+                        vec const low = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1, 1, 1, 1));
+                        return _mm256_add_epi64(v,
+                            _mm256_blend_epi32(_mm256_setzero_si256(), low, 0xf0));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec last(vec v, int_tag<4>)
+                    {
+                        return _mm256_permutevar8x32_epi32(v, _mm256_set1_epi32(7));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static vec last(vec v, int_tag<8>)
+                    {
+                        return _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 3, 3, 3));
+                    }
+                };
+
+                // The kernels are spelled out once and stamped out for each
+                // instruction set; a function can only inline the intrinsics of the
+                // instruction set it is compiled for.
+                //
+                // scan writes sum + p[0] + ... + p[i] (up to p[i - 1] if Exclusive) to
+                // out[i]. The carry into each vector is the carry into the one before
+                // plus that one's total, which doesn't wait on the adds within it.
+                // difference writes p[i] - p[i - 1] to out[i], with prev before p[0].
+                // Each vector's predecessors are shifted in from the vector before,
+                // kept in a register, so out may be p.
+#define RANGES_SIMD_DEFINE_KERNELS(NAME, OPS, TARGET)                                 \
+                struct NAME                                                           \
+                {                                                                     \
+                    template<typename T>                                              \
+                    TARGET static std::size_t find(T const *p, std::size_t n, T v)    \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto const needle = OPS::splat(v);                            \
+                        std::size_t i = 0;                                            \
+                        for(; i + step <= n; i += step)                               \
+                            if(std::uint32_t m =                                      \
+                                    OPS::eq(OPS::load(p + i), needle, lane_tag<T>{})) \
+                                return i + std::size_t(__builtin_ctz(m)) / sizeof(T); \
+                        for(; i != n; ++i)                                            \
+                            if(p[i] == v)                                             \
+                                break;                                                \
+                        return i;                                                     \
+                    }                                                                 \
+                    template<typename T>                                              \
+                    TARGET static std::size_t count(T const *p, std::size_t n, T v)   \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto const needle = OPS::splat(v);                            \
+                        std::size_t bits = 0, i = 0;                                  \
+                        for(; i + step <= n; i += step)                               \
+                            bits += std::size_t(__builtin_popcount(                   \
+                                OPS::eq(OPS::load(p + i), needle, lane_tag<T>{})));   \
+                        std::size_t c = bits / sizeof(T);                             \
+                        for(; i != n; ++i)                                            \
+                            c += p[i] == v;                                           \
+                        return c;                                                     \
+                    }                                                                 \
+                    template<typename T>                                              \
+                    TARGET static std::size_t mismatch(T const *a, T const *b,        \
+                        std::size_t n)                                                \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        std::size_t i = 0;                                            \
+                        for(; i + step <= n; i += step)                               \
+                        {                                                             \
+                            std::uint32_t const m = OPS::eq(OPS::load(a + i),         \
+                                OPS::load(b + i), lane_tag<T>{});                     \
+                            if(m != OPS::all)                                         \
+                                return i + std::size_t(__builtin_ctz(~m)) / sizeof(T);\
+                        }                                                             \
+                        for(; i != n; ++i)                                            \
+                            if(!(a[i] == b[i]))                                       \
+                                break;                                                \
+                        return i;                                                     \
+                    }                                                                 \
+                    template<bool Exclusive, typename T>                              \
+                    TARGET static T scan(T const *p, T *out, std::size_t n, T sum)    \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto carry = OPS::splat(sum);                                 \
+                        std::size_t i = 0;                                            \
+                        for(; i + step <= n; i += step)                               \
+                        {                                                             \
+                            auto const x = OPS::load(p + i);                          \
+                            auto const s = OPS::prefix(x, lane_tag<T>{});             \
+                            OPS::store(out + i, OPS::add(carry, Exclusive ?           \
+                                OPS::sub(s, x, lane_tag<T>{}) : s, lane_tag<T>{}));   \
+                            carry = OPS::add(carry, OPS::last(s, lane_tag<T>{}),      \
+                                lane_tag<T>{});                                       \
+                        }                                                             \
+                        T lanes[step];                                                \
+                        OPS::store(lanes, carry);                                     \
+                        sum = lanes[0];                                               \
+                        for(; i != n; ++i)                                            \
+                        {                                                             \
+                            T const x = p[i];                                         \
+                            T const next =                                            \
+                                simd::wrap_add(sum, x, std::true_type{});             \
+                            out[i] = Exclusive ? sum : next;                          \
+                            sum = next;                                               \
+                        }                                                             \
+                        return sum;                                                   \
+                    }                                                                 \
+                    template<typename T>                                              \
+                    TARGET static void difference(T const *p, T *out, std::size_t n,  \
+                        T prev)                                                       \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto last = OPS::splat(prev);                                 \
+                        std::size_t i = 0;                                            \
+                        for(; i + step <= n; i += step)                               \
+                        {                                                             \
+                            auto const x = OPS::load(p + i);                          \
+                            OPS::store(out + i, OPS::sub(x,                           \
+                                OPS::template shift_in<sizeof(T)>(last, x),           \
+                                lane_tag<T>{}));                                      \
+                            last = x;                                                 \
+                        }                                                             \
+                        T lanes[step];                                                \
+                        OPS::store(lanes, last);                                      \
+                        prev = lanes[step - 1];                                       \
+                        for(; i != n; ++i)                                            \
+                        {                                                             \
+                            T const x = p[i];                                         \
+                            out[i] =                                                  \
+                                simd::wrap_sub(x, prev, std::is_integral<T>{});       \
+                            prev = x;                                                 \
+                        }                                                             \
+                    }                                                                 \
+                }                                                                     \
+                /**/
+
+                RANGES_SIMD_DEFINE_KERNELS(sse2_kernels, sse2, );
+                RANGES_SIMD_DEFINE_KERNELS(avx2_kernels, avx2, RANGES_SIMD_TARGET_AVX2);
+
+#undef RANGES_SIMD_DEFINE_KERNELS
+
+                // Arithmetic on vectors of float or double, chosen by overloading on
+                // the element type.
+                struct sse2_fp
+                {
+                    static constexpr std::size_t width = 16;
+
+                    static __m128 load(float const *p) { return _mm_loadu_ps(p); }
+                    static __m128d load(double const *p) { return _mm_loadu_pd(p); }
+                    static void store(float *p, __m128 v) { _mm_storeu_ps(p, v); }
+                    static void store(double *p, __m128d v) { _mm_storeu_pd(p, v); }
+                    static __m128 splat(float v) { return _mm_set1_ps(v); }
+                    static __m128d splat(double v) { return _mm_set1_pd(v); }
+                    static __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+                    static __m128d add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+                    static __m128 mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+                    static __m128d mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+                    // a * b + c; SSE2 has no fused multiply-add.
+                    static __m128 fmadd(__m128 a, __m128 b, __m128 c)
+                    {
+                        return _mm_add_ps(_mm_mul_ps(a, b), c);
+                    }
+                    static __m128d fmadd(__m128d a, __m128d b, __m128d c)
+                    {
+                        return _mm_add_pd(_mm_mul_pd(a, b), c);
+                    }
+                };
+
+                struct avx2_fp
+                {
+                    static constexpr std::size_t width = 32;
+
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256 load(float const *p)
+                    {
+                        return _mm256_loadu_ps(p);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256d load(double const *p)
+                    {
+                        return _mm256_loadu_pd(p);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static void store(float *p, __m256 v)
+                    {
+                        _mm256_storeu_ps(p, v);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static void store(double *p, __m256d v)
+                    {
+                        _mm256_storeu_pd(p, v);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256 splat(float v)
+                    {
+                        return _mm256_set1_ps(v);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256d splat(double v)
+                    {
+                        return _mm256_set1_pd(v);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256 add(__m256 a, __m256 b)
+                    {
+                        return _mm256_add_ps(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256d add(__m256d a, __m256d b)
+                    {
+                        return _mm256_add_pd(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256 mul(__m256 a, __m256 b)
+                    {
+                        return _mm256_mul_ps(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256d mul(__m256d a, __m256d b)
+                    {
+                        return _mm256_mul_pd(a, b);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256 fmadd(__m256 a, __m256 b, __m256 c)
+                    {
+                        return _mm256_fmadd_ps(a, b, c);
+                    }
+                    RANGES_SIMD_TARGET_AVX2_FMA static __m256d fmadd(__m256d a, __m256d b,
+                        __m256d c)
+                    {
+                        return _mm256_fmadd_pd(a, b, c);
+                    }
+                };
+
+                // Folds carry four vectors of partial results, so that each add or
+                // multiply waits only on the one four steps before it rather than on
+                // the one just before. That reorders the operations, so the results
+                // may round differently from a left fold.
+#define RANGES_SIMD_DEFINE_FP_KERNELS(NAME, OPS, TARGET)                              \
+                struct NAME                                                           \
+                {                                                                     \
+                    template<typename T>                                              \
+                    TARGET static T sum(T const *p, std::size_t n)                    \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto a0 = OPS::splat(T(0)), a1 = a0, a2 = a0, a3 = a0;        \
+                        std::size_t i = 0;                                            \
+                        for(; i + 4 * step <= n; i += 4 * step)                       \
+                        {                                                             \
+                            a0 = OPS::add(a0, OPS::load(p + i));                      \
+                            a1 = OPS::add(a1, OPS::load(p + i + step));               \
+                            a2 = OPS::add(a2, OPS::load(p + i + 2 * step));           \
+                            a3 = OPS::add(a3, OPS::load(p + i + 3 * step));           \
+                        }                                                             \
+                        for(; i + step <= n; i += step)                               \
+                            a0 = OPS::add(a0, OPS::load(p + i));                      \
+                        T lanes[step];                                                \
+                        OPS::store(lanes, OPS::add(OPS::add(a0, a1), OPS::add(a2, a3)));\
+                        T s = T(0);                                                   \
+                        for(T t : lanes)                                              \
+                            s += t;                                                   \
+                        for(; i != n; ++i)                                            \
+                            s += p[i];                                                \
+                        return s;                                                     \
+                    }                                                                 \
+                    template<typename T>                                              \
+                    TARGET static T product(T const *p, std::size_t n)                \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto a0 = OPS::splat(T(1)), a1 = a0, a2 = a0, a3 = a0;        \
+                        std::size_t i = 0;                                            \
+                        for(; i + 4 * step <= n; i += 4 * step)                       \
+                        {                                                             \
+                            a0 = OPS::mul(a0, OPS::load(p + i));                      \
+                            a1 = OPS::mul(a1, OPS::load(p + i + step));               \
+                            a2 = OPS::mul(a2, OPS::load(p + i + 2 * step));           \
+                            a3 = OPS::mul(a3, OPS::load(p + i + 3 * step));           \
+                        }                                                             \
+                        for(; i + step <= n; i += step)                               \
+                            a0 = OPS::mul(a0, OPS::load(p + i));                      \
+                        T lanes[step];                                                \
+                        OPS::store(lanes, OPS::mul(OPS::mul(a0, a1), OPS::mul(a2, a3)));\
+                        T s = T(1);                                                   \
+                        for(T t : lanes)                                              \
+                            s *= t;                                                   \
+                        for(; i != n; ++i)                                            \
+                            s *= p[i];                                                \
+                        return s;                                                     \
+                    }                                                                 \
+                    template<typename T>                                              \
+                    TARGET static T dot(T const *a, T const *b, std::size_t n)        \
+                    {                                                                 \
+                        constexpr std::size_t step = OPS::width / sizeof(T);          \
+                        auto a0 = OPS::splat(T(0)), a1 = a0, a2 = a0, a3 = a0;        \
+                        std::size_t i = 0;                                            \
+                        for(; i + 4 * step <= n; i += 4 * step)                       \
+                        {                                                             \
+                            a0 = OPS::fmadd(OPS::load(a + i), OPS::load(b + i), a0);  \
+                            a1 = OPS::fmadd(OPS::load(a + i + step),                  \
+                                OPS::load(b + i + step), a1);                         \
+                            a2 = OPS::fmadd(OPS::load(a + i + 2 * step),              \
+                                OPS::load(b + i + 2 * step), a2);                     \
+                            a3 = OPS::fmadd(OPS::load(a + i + 3 * step),              \
+                                OPS::load(b + i + 3 * step), a3);                     \
+                        }                                                             \
+                        for(; i + step <= n; i += step)                               \
+                            a0 = OPS::fmadd(OPS::load(a + i), OPS::load(b + i), a0);  \
+                        T lanes[step];                                                \
+                        OPS::store(lanes, OPS::add(OPS::add(a0, a1), OPS::add(a2, a3)));\
+                        T s = T(0);                                                   \
+                        for(T t : lanes)                                              \
+                            s += t;                                                   \
+                        for(; i != n; ++i)                                            \
+                            s += a[i] * b[i];                                         \
+                        return s;                                                     \
+                    }                                                                 \
+                }                                                                     \
+                /**/
+
+                RANGES_SIMD_DEFINE_FP_KERNELS(sse2_fp_kernels, sse2_fp, );
+                RANGES_SIMD_DEFINE_FP_KERNELS(avx2_fp_kernels, avx2_fp,
+                    RANGES_SIMD_TARGET_AVX2_FMA);
+
+#undef RANGES_SIMD_DEFINE_FP_KERNELS
+
+                inline bool has_avx2()
+                {
+#ifdef __AVX2__
+                    return true;
+#else
+                    static bool const avx2 =
+                        (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+                    return avx2;
+#endif
+                }
+
+                inline bool has_avx2_fma()
+                {
+#if defined(__AVX2__) && defined(__FMA__)
+                    return true;
+#else
+                    static bool const fma = simd::has_avx2() &&
+                        (__builtin_cpu_init(), __builtin_cpu_supports("fma") != 0);
+                    return fma;
+#endif
+                }
+
+                /// The index of the first element of [p, p + n) equal to v, or n.
+                template<typename T>
+                std::size_t find(T const *p, std::size_t n, T v)
+                {
+                    return simd::has_avx2() ? avx2_kernels::find(p, n, v) :
+                        sse2_kernels::find(p, n, v);
+                }
+
+                /// The number of elements of [p, p + n) equal to v.
+                template<typename T>
+                std::size_t count(T const *p, std::size_t n, T v)
+                {
+                    return simd::has_avx2() ? avx2_kernels::count(p, n, v) :
+                        sse2_kernels::count(p, n, v);
+                }
+
+                /// The index of the first i for which a[i] != b[i], or n.
+                template<typename T>
+                std::size_t mismatch(T const *a, T const *b, std::size_t n)
+                {
+                    return simd::has_avx2() ? avx2_kernels::mismatch(a, b, n) :
+                        sse2_kernels::mismatch(a, b, n);
+                }
+
+                /// Writes the running sums of the 32- or 64-bit integers of
+                /// [p, p + n), starting from sum, to [out, out + n), and returns
+                /// the total. out may be p.
+                template<bool Exclusive, typename T>
+                T scan(T const *p, T *out, std::size_t n, T sum)
+                {
+                    return simd::has_avx2() ?
+                        avx2_kernels::template scan<Exclusive>(p, out, n, sum) :
+                        sse2_kernels::template scan<Exclusive>(p, out, n, sum);
+                }
+
+                /// Writes p[i] - p[i - 1] to out[i] for the 32- or 64-bit integers,
+                /// floats or doubles of [p, p + n), taking p[-1] to be prev. out may
+                /// be p.
+                template<typename T>
+                void difference(T const *p, T *out, std::size_t n, T prev)
+                {
+                    simd::has_avx2() ? avx2_kernels::difference(p, out, n, prev) :
+                        sse2_kernels::difference(p, out, n, prev);
+                }
+
+                /// The sum of the float or double elements of [p, p + n), in no
+                /// particular order.
+                template<typename T>
+                T sum(T const *p, std::size_t n)
+                {
+                    return simd::has_avx2_fma() ? avx2_fp_kernels::sum(p, n) :
+                        sse2_fp_kernels::sum(p, n);
+                }
+
+                /// The product of the float or double elements of [p, p + n), in no
+                /// particular order.
+                template<typename T>
+                T product(T const *p, std::size_t n)
+                {
+                    return simd::has_avx2_fma() ? avx2_fp_kernels::product(p, n) :
+                        sse2_fp_kernels::product(p, n);
+                }
+
+                /// The sum of a[i] * b[i] over [0, n), in no particular order, and
+                /// with fused multiply-adds where the CPU has them.
+                template<typename T>
+                T dot(T const *a, T const *b, std::size_t n)
+                {
+                    return simd::has_avx2_fma() ? avx2_fp_kernels::dot(a, b, n) :
+                        sse2_fp_kernels::dot(a, b, n);
+                }
+            }
+#endif
+        }
+        /// \endcond
+    }
+}
+
+#endif
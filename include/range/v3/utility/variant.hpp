@@ -65,6 +65,54 @@ namespace ranges
             template<typename...List>
             union variant_data;
 
+            // The I-th alternative of a variant_data. Every member of a union lives at
+            // the same address, so this costs nothing at run time.
+            template<std::size_t I>
+            struct variant_at
+            {
+                template<typename Data>
+                static auto get(Data &data) -> decltype(variant_at<I - 1>::get(data.tail))
+                {
+                    return variant_at<I - 1>::get(data.tail);
+                }
+            };
+
+            template<>
+            struct variant_at<0>
+            {
+                template<typename Data>
+                static auto get(Data &data) -> decltype((data.head))
+                {
+                    return data.head;
+                }
+            };
+
+            // Calls fun(meta::size_t<n>{}) for a run-time n in [Lo, Hi), halving the
+            // interval at each step: log(N) branches that the compiler can inline,
+            // rather than a comparison per alternative.
+            template<std::size_t Lo, std::size_t Hi, bool Leaf = (Hi - Lo == 1)>
+            struct variant_dispatch
+            {
+                template<typename Fun>
+                static auto call(std::size_t n, Fun &fun) -> decltype(fun(meta::size_t<Lo>{}))
+                {
+                    return n < (Lo + Hi) / 2 ?
+                        variant_dispatch<Lo, (Lo + Hi) / 2>::call(n, fun) :
+                        variant_dispatch<(Lo + Hi) / 2, Hi>::call(n, fun);
+                }
+            };
+
+            template<std::size_t Lo, std::size_t Hi>
+            struct variant_dispatch<Lo, Hi, true>
+            {
+                template<typename Fun>
+                static auto call(std::size_t n, Fun &fun) -> decltype(fun(meta::size_t<Lo>{}))
+                {
+                    RANGES_ASSERT(n == Lo);
+                    return fun(meta::size_t<Lo>{});
+                }
+            };
+
             template<>
             union variant_data<>
             {
@@ -102,14 +150,64 @@ namespace ranges
                 head_t head;
                 tail_t tail;
 
-                template<typename This, typename Fun, std::size_t N>
-                static void apply_(This &this_, std::size_t n, Fun &&fun, meta::size_t<N> u)
+                template<std::size_t I>
+                friend struct variant_at;
+                template<typename This, std::size_t I>
+                static auto at_(This &this_, meta::size_t<I>) ->
+                    decltype(variant_at<I>::get(this_))
                 {
-                    if(0 == n)
-                        detail::apply_if(detail::forward<Fun>(fun), this_.head, u);
-                    else
-                        this_.tail.apply(n - 1, detail::forward<Fun>(fun), meta::size_t<N + 1>{});
+                    return variant_at<I>::get(this_);
                 }
+
+                struct move_fn
+                {
+                    variant_data &to_, &from_;
+                    template<std::size_t I>
+                    void operator()(meta::size_t<I> i) const
+                    {
+                        auto &t = variant_data::at_(to_, i);
+                        using U = meta::eval<std::remove_reference<decltype(t)>>;
+                        ::new(static_cast<void *>(std::addressof(t)))
+                            U(std::move(variant_data::at_(from_, i)));
+                    }
+                };
+                struct copy_fn
+                {
+                    variant_data &to_;
+                    variant_data const &from_;
+                    template<std::size_t I>
+                    void operator()(meta::size_t<I> i) const
+                    {
+                        auto &t = variant_data::at_(to_, i);
+                        using U = meta::eval<std::remove_reference<decltype(t)>>;
+                        ::new(static_cast<void *>(std::addressof(t)))
+                            U(variant_data::at_(from_, i));
+                    }
+                };
+                template<typename That>
+                struct equal_fn
+                {
+                    variant_data const &lhs_;
+                    That const &rhs_;
+                    template<std::size_t I>
+                    bool operator()(meta::size_t<I> i) const
+                    {
+                        return variant_data::at_(lhs_, i) == That::at_(rhs_, i);
+                    }
+                };
+                template<typename This, typename Fun, std::size_t N>
+                struct apply_fn
+                {
+                    This &this_;
+                    Fun &fun_;
+                    template<std::size_t I>
+                    void operator()(meta::size_t<I> i) const
+                    {
+                        detail::apply_if(detail::forward<Fun>(fun_), variant_data::at_(this_, i),
+                            meta::size_t<N + I>{});
+                    }
+                };
+                using dispatch_t = variant_dispatch<0, sizeof...(Ts) + 1>;
             public:
                 variant_data()
                 {}
@@ -128,35 +226,42 @@ namespace ranges
                 {}
                 void move(std::size_t n, variant_data &&that)
                 {
-                    if(n == 0)
-                        ::new(static_cast<void *>(&head)) head_t(std::move(that).head);
-                    else
-                        tail.move(n - 1, std::move(that).tail);
+                    move_fn fn{*this, that};
+                    dispatch_t::call(n, fn);
                 }
                 void copy(std::size_t n, variant_data const &that)
                 {
-                    if(n == 0)
-                        ::new(static_cast<void *>(&head)) head_t(that.head);
-                    else
-                        tail.copy(n - 1, that.tail);
+                    copy_fn fn{*this, that};
+                    dispatch_t::call(n, fn);
                 }
                 template<typename U, typename...Us>
                 bool equal(std::size_t n, variant_data<U, Us...> const &that) const
                 {
-                    if(n == 0)
-                        return head == that.head;
-                    else
-                        return tail.equal(n - 1, that.tail);
+                    equal_fn<variant_data<U, Us...>> fn{*this, that};
+                    return dispatch_t::call(n, fn);
                 }
                 template<typename Fun, std::size_t N = 0>
-                void apply(std::size_t n, Fun &&fun, meta::size_t<N> u = meta::size_t<N>{})
+                void apply(std::size_t n, Fun &&fun, meta::size_t<N> = meta::size_t<N>{})
                 {
-                    variant_data::apply_(*this, n, std::forward<Fun>(fun), u);
+                    apply_fn<variant_data, Fun, N> fn{*this, fun};
+                    dispatch_t::call(n, fn);
                 }
                 template<typename Fun, std::size_t N = 0>
-                void apply(std::size_t n, Fun &&fun, meta::size_t<N> u = meta::size_t<N>{}) const
+                void apply(std::size_t n, Fun &&fun, meta::size_t<N> = meta::size_t<N>{}) const
+                {
+                    apply_fn<variant_data const, Fun, N> fn{*this, fun};
+                    dispatch_t::call(n, fn);
+                }
+                template<std::size_t I>
+                auto at(meta::size_t<I> i) -> decltype(at_(std::declval<variant_data &>(), i))
+                {
+                    return variant_data::at_(*this, i);
+                }
+                template<std::size_t I>
+                auto at(meta::size_t<I> i) const ->
+                    decltype(at_(std::declval<variant_data const &>(), i))
                 {
-                    variant_data::apply_(*this, n, std::forward<Fun>(fun), u);
+                    return variant_data::at_(*this, i);
                 }
             };
 
@@ -218,21 +323,6 @@ namespace ranges
                 }
             };
 
-            template<typename T>
-            struct get_fun : assert_otherwise
-            {
-            private:
-                T *&t_;
-            public:
-                get_fun(T *&t)
-                  : t_(t)
-                {}
-                void operator()(T &t) const
-                {
-                    t_ = std::addressof(t);
-                }
-            };
-
             template<typename Fun, typename Var = std::nullptr_t>
             struct apply_visitor
             {
@@ -467,7 +557,7 @@ namespace ranges
             void set(U &&u)
             {
                 clear_();
-                data_.apply(N, detail::make_unary_visitor(detail::construct_fun<U>{std::forward<U>(u)}));
+                detail::construct_fun<U>{std::forward<U>(u)}(data_.at(meta::size_t<N>{}));
                 which_ = N;
             }
             bool is_valid() const
@@ -549,15 +639,8 @@ namespace ranges
         get(tagged_variant<Ts...> &var)
         {
             RANGES_ASSERT(N == var.which());
-            using elem_t =
-                meta::eval<std::remove_reference<
-                    tagged_variant_element_t<N, tagged_variant<Ts...>>>>;
-            using get_fun = detail::get_fun<elem_t>;
-            elem_t *elem = nullptr;
             auto &data = detail::variant_core_access::data(var);
-            data.apply(N, detail::make_unary_visitor(detail::unwrap_ref_fun<get_fun>{get_fun(elem)}));
-            RANGES_ASSERT(elem != nullptr);
-            return *elem;
+            return unwrap_reference(data.at(meta::size_t<N>{}));
         }
 
         template<std::size_t N, typename...Ts>
@@ -565,18 +648,8 @@ namespace ranges
         get(tagged_variant<Ts...> const &var)
         {
             RANGES_ASSERT(N == var.which());
-            using elem_t =
-                meta::apply<
-                    meta::compose<
-                        meta::quote_trait<std::remove_reference>,
-                        meta::quote_trait<std::add_const>
-                    >, tagged_variant_element_t<N, tagged_variant<Ts...>>>;
-            using get_fun = detail::get_fun<elem_t>;
-            elem_t *elem = nullptr;
             auto &data = detail::variant_core_access::data(var);
-            data.apply(N, detail::make_unary_visitor(detail::unwrap_ref_fun<get_fun>{get_fun(elem)}));
-            RANGES_ASSERT(elem != nullptr);
-            return *elem;
+            return unwrap_reference(data.at(meta::size_t<N>{}));
         }
 
         template<std::size_t N, typename...Ts>
@@ -584,15 +657,9 @@ namespace ranges
         get(tagged_variant<Ts...> &&var)
         {
             RANGES_ASSERT(N == var.which());
-            using elem_t =
-                meta::eval<std::remove_reference<
-                    tagged_variant_element_t<N, tagged_variant<Ts...>>>>;
-            using get_fun = detail::get_fun<elem_t>;
-            elem_t *elem = nullptr;
             auto &data = detail::variant_core_access::data(var);
-            data.apply(N, detail::make_unary_visitor(detail::unwrap_ref_fun<get_fun>{get_fun(elem)}));
-            RANGES_ASSERT(elem != nullptr);
-            return std::forward<tagged_variant_element_t<N, tagged_variant<Ts...>>>(*elem);
+            return std::forward<tagged_variant_element_t<N, tagged_variant<Ts...>>>(
+                unwrap_reference(data.at(meta::size_t<N>{})));
         }
 
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,89 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_VARINT_HPP
+#define RANGES_V3_UTILITY_VARINT_HPP
+
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The integer types delta_encode and view::delta_decode handle.
+            template<typename T>
+            using is_delta_codable = meta::bool_<
+                std::is_integral<T>::value && !std::is_same<T, bool>::value>;
+
+            // T - prev, wrapped around in the unsigned type of T's size. For signed
+            // T the difference is zigzagged, 0, -1, 1, -2... to 0, 1, 2, 3..., so
+            // that small steps either way are small numbers.
+            template<typename T, typename U = meta::eval<std::make_unsigned<T>>>
+            U delta_of(T t, T prev)
+            {
+                U const d = static_cast<U>(static_cast<U>(t) - static_cast<U>(prev));
+                if(!std::is_signed<T>::value)
+                    return d;
+                U const sign = static_cast<U>(d >> (std::numeric_limits<U>::digits - 1));
+                return static_cast<U>(static_cast<U>(d << 1) ^ static_cast<U>(U(0) - sign));
+            }
+
+            // The inverse of delta_of: prev plus the difference d.
+            template<typename T, typename U = meta::eval<std::make_unsigned<T>>>
+            T undelta(U d, T prev)
+            {
+                if(std::is_signed<T>::value)
+                    d = static_cast<U>(static_cast<U>(d >> 1) ^ static_cast<U>(U(0) - (d & 1u)));
+                return static_cast<T>(static_cast<U>(static_cast<U>(prev) + d));
+            }
+
+            // Writes u seven bits at a time, low bits first, with the top bit of
+            // each byte but the last set.
+            template<typename U, typename O>
+            O varint_write(U u, O out)
+            {
+                for(; u >= 0x80u; u = static_cast<U>(u >> 7), ++out)
+                    *out = static_cast<std::uint8_t>(u | 0x80u);
+                *out = static_cast<std::uint8_t>(u);
+                return ++out;
+            }
+
+            // Reads what varint_write wrote, from it up to end; bits beyond the
+            // width of U are dropped. Leaves it after the last byte read.
+            template<typename U, typename I, typename S>
+            U varint_read(I &it, S const &end)
+            {
+                U u = 0;
+                for(int shift = 0; it != end; shift += 7)
+                {
+                    auto const b = static_cast<std::uint8_t>(*it);
+                    ++it;
+                    if(shift < std::numeric_limits<U>::digits)
+                        u = static_cast<U>(u | (static_cast<U>(b & 0x7fu) << shift));
+                    if(!(b & 0x80u))
+                        break;
+                }
+                return u;
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
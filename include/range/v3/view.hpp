@@ -25,6 +25,7 @@
 #include <range/v3/view/const.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/delimit.hpp>
+#include <range/v3/view/delta_decode.hpp>
 #include <range/v3/view/drop.hpp>
 #include <range/v3/view/drop_while.hpp>
 #include <range/v3/view/empty.hpp>
@@ -14,7 +14,10 @@
 #ifndef RANGES_V3_VIEW_ANY_RANGE_HPP
 #define RANGES_V3_VIEW_ANY_RANGE_HPP
 
+#include <new>
 #include <memory>
+#include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
@@ -22,6 +25,8 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/view/all.hpp>
 
 namespace ranges
@@ -31,244 +36,546 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            template<typename Ref>
-            struct any_input_cursor_interface
+            // Room for an iterator/sentinel pair of a few words each, plus a vptr.
+            constexpr std::size_t any_small_buffer_size = 6 * sizeof(void *);
+
+            using any_small_buffer =
+                meta::eval<std::aligned_storage<any_small_buffer_size>>;
+
+            template<typename T>
+            using any_fits_inline = meta::bool_<
+                sizeof(T) <= sizeof(any_small_buffer) &&
+                alignof(T) <= alignof(any_small_buffer) &&
+                std::is_nothrow_move_constructible<T>::value>;
+
+            template<typename T, typename...Args>
+            T *any_construct_(std::true_type, any_small_buffer &buf, Args &&...args)
             {
-                virtual ~any_input_cursor_interface() {}
-                virtual Ref current() const = 0;
-                virtual bool equal(any_input_cursor_interface const &) const = 0;
-                virtual void next() = 0;
-                virtual any_input_cursor_interface *clone() const = 0;
-            };
+                return ::new(static_cast<void *>(&buf)) T(std::forward<Args>(args)...);
+            }
+
+            template<typename T, typename...Args>
+            T *any_construct_(std::false_type, any_small_buffer &, Args &&...args)
+            {
+                return new T(std::forward<Args>(args)...);
+            }
 
-            template<typename S, typename I>
-            struct any_input_sentinel_impl;
+            // Constructs a T in buf if it fits there, and on the heap otherwise.
+            template<typename T, typename...Args>
+            T *any_construct(any_small_buffer &buf, Args &&...args)
+            {
+                return detail::any_construct_<T>(any_fits_inline<T>{}, buf,
+                    std::forward<Args>(args)...);
+            }
+
+            // Implements the clone and move members that any_ptr needs of the
+            // objects it holds.
+            template<typename Impl, typename Interface>
+            struct any_cloneable
+              : Interface
+            {
+                Interface *clone(any_small_buffer &buf) const override
+                {
+                    return detail::any_construct<Impl>(buf, static_cast<Impl const &>(*this));
+                }
+                // Only called on objects that live in a small buffer, which are
+                // nothrow-movable.
+                Interface *move(any_small_buffer &buf) noexcept override
+                {
+                    return detail::any_construct<Impl>(buf, std::move(static_cast<Impl &>(*this)));
+                }
+            };
 
-            template<typename I>
-            struct any_input_cursor_impl
-              : any_input_cursor_interface<iterator_reference_t<I>>
+            // Owns a polymorphic object, which is stored inline when it is small
+            // and nothrow-movable, and on the heap otherwise. The object must
+            // derive from any_cloneable.
+            template<typename Interface>
+            struct any_ptr
             {
             private:
-                template<typename S, typename II>
-                friend struct any_input_sentinel_impl;
-                I it_;
+                any_small_buffer buf_;
+                Interface *ptr_;
+                bool is_inline() const
+                {
+                    return static_cast<void const *>(ptr_) == static_cast<void const *>(&buf_);
+                }
+                void steal(any_ptr &that) noexcept
+                {
+                    if(that.is_inline())
+                    {
+                        ptr_ = that.ptr_->move(buf_);
+                        that.reset();
+                    }
+                    else
+                    {
+                        ptr_ = that.ptr_;
+                        that.ptr_ = nullptr;
+                    }
+                }
             public:
-                any_input_cursor_impl() = default;
-                any_input_cursor_impl(I it)
-                  : it_(std::move(it))
+                any_ptr()
+                  : ptr_(nullptr)
                 {}
-                iterator_reference_t<I> current() const override
+                template<typename T, typename...Args>
+                explicit any_ptr(meta::id<T>, Args &&...args)
+                  : ptr_(detail::any_construct<T>(buf_, std::forward<Args>(args)...))
+                {}
+                any_ptr(any_ptr &&that) noexcept
+                  : ptr_(nullptr)
                 {
-                    return *it_;
+                    steal(that);
                 }
-                bool equal(any_input_cursor_interface<iterator_reference_t<I>> const &that) const override
+                any_ptr(any_ptr const &that)
+                  : ptr_(that.ptr_ ? that.ptr_->clone(buf_) : nullptr)
+                {}
+                any_ptr &operator=(any_ptr &&that) noexcept
                 {
-                    any_input_cursor_impl const *pthat =
-                        dynamic_cast<any_input_cursor_impl const *>(&that);
-                    RANGES_ASSERT(pthat != nullptr);
-                    return pthat->it_ == it_;
+                    if(this != &that)
+                    {
+                        reset();
+                        steal(that);
+                    }
+                    return *this;
                 }
-                void next() override
+                any_ptr &operator=(any_ptr const &that)
                 {
-                    ++it_;
+                    any_ptr tmp{that};
+                    return *this = std::move(tmp);
                 }
-                any_input_cursor_impl *clone() const override
+                ~any_ptr()
                 {
-                    return new any_input_cursor_impl{it_};
+                    reset();
+                }
+                void reset() noexcept
+                {
+                    if(is_inline())
+                        ptr_->~Interface();
+                    else
+                        delete ptr_;
+                    ptr_ = nullptr;
+                }
+                Interface *get() const
+                {
+                    return ptr_;
+                }
+                Interface *operator->() const
+                {
+                    return ptr_;
+                }
+                Interface &operator*() const
+                {
+                    return *ptr_;
                 }
             };
 
-            template<typename Ref>
-            struct any_input_sentinel_interface
+            template<typename Cat>
+            using any_is_multi_pass = Derived<Cat, ranges::forward_iterator_tag>;
+
+            template<typename Cat>
+            using any_is_bidirectional = Derived<Cat, ranges::bidirectional_iterator_tag>;
+
+            template<typename Cat>
+            using any_is_random_access = Derived<Cat, ranges::random_access_iterator_tag>;
+
+            template<typename Cat>
+            struct any_category_concept;
+
+            template<>
+            struct any_category_concept<ranges::input_iterator_tag>
             {
-                virtual ~any_input_sentinel_interface() {}
-                virtual bool equal(any_input_cursor_interface<Ref> const &) const = 0;
-                virtual any_input_sentinel_interface *clone() const = 0;
+                using type = concepts::InputIterable;
             };
 
-            template<typename S, typename I>
-            struct any_input_sentinel_impl
-              : any_input_sentinel_interface<iterator_reference_t<I>>
+            template<>
+            struct any_category_concept<ranges::forward_iterator_tag>
             {
-            private:
-                S s_;
-            public:
-                any_input_sentinel_impl() = default;
-                any_input_sentinel_impl(S s)
-                  : s_(std::move(s))
-                {}
-                bool equal(any_input_cursor_interface<iterator_reference_t<I>> const &that) const override
-                {
-                    any_input_cursor_impl<I> const *pthat =
-                        dynamic_cast<any_input_cursor_impl<I> const *>(&that);
-                    RANGES_ASSERT(pthat != nullptr);
-                    return s_ == pthat->it_;
-                }
-                any_input_sentinel_impl *clone() const override
-                {
-                    return new any_input_sentinel_impl{s_};
-                }
+                using type = concepts::ForwardIterable;
             };
 
-            template<typename Ref>
-            struct any_input_sentinel;
+            template<>
+            struct any_category_concept<ranges::bidirectional_iterator_tag>
+            {
+                using type = concepts::BidirectionalIterable;
+            };
+
+            template<>
+            struct any_category_concept<ranges::random_access_iterator_tag>
+            {
+                using type = concepts::RandomAccessIterable;
+            };
 
+            template<typename Rng, typename Cat>
+            using AnyErasable = concepts::models<meta::eval<any_category_concept<Cat>>, Rng>;
+
+            // Ranges whose elements are known to be laid out in one array: raw
+            // arrays, and containers with a data() member that points at their
+            // elements.
+            template<typename Rng, typename Enable = void>
+            struct any_is_contiguous
+              : std::is_array<meta::eval<std::remove_reference<Rng>>>
+            {};
+
+            template<typename Rng>
+            struct any_is_contiguous<Rng, void_t<decltype(std::declval<Rng &>().data())>>
+              : meta::and_<
+                    std::is_lvalue_reference<range_reference_t<Rng>>,
+                    std::is_same<decltype(std::declval<Rng &>().data()),
+                        meta::eval<std::add_pointer<range_reference_t<Rng>>>>>
+            {};
+
+            // One interface for every category. The operations a category doesn't
+            // support are never called through an any_cursor of that category.
             template<typename Ref>
-            struct any_input_cursor
+            struct any_cursor_interface
+            {
+                using value_type = meta::eval<std::decay<Ref>>;
+                virtual ~any_cursor_interface() {}
+                virtual Ref current() const = 0;
+                virtual bool equal(any_cursor_interface const &) const = 0;
+                virtual bool done() const = 0;
+                virtual void next() = 0;
+                virtual void prev() = 0;
+                virtual void advance(std::ptrdiff_t) = 0;
+                virtual std::ptrdiff_t distance_to(any_cursor_interface const &) const = 0;
+                // Advance by up to n elements, or read up to n elements into out,
+                // stopping early at the end. Return the number of elements consumed.
+                virtual std::ptrdiff_t next_n(std::ptrdiff_t n) = 0;
+                virtual std::ptrdiff_t read_into(value_type *out, std::ptrdiff_t n) = 0;
+                virtual any_cursor_interface *clone(any_small_buffer &) const = 0;
+                virtual any_cursor_interface *move(any_small_buffer &) noexcept = 0;
+            };
+
+            // The cursor carries its own end, so reaching it takes no second
+            // erased object and no cross-cast.
+            template<typename I, typename S>
+            struct any_cursor_impl
+              : any_cloneable<any_cursor_impl<I, S>,
+                    any_cursor_interface<iterator_reference_t<I>>>
             {
             private:
-                friend struct any_input_sentinel<Ref>;
-                std::unique_ptr<any_input_cursor_interface<Ref>> ptr_;
+                using interface_t = any_cursor_interface<iterator_reference_t<I>>;
+                using value_type = typename interface_t::value_type;
+                I it_;
+                S end_;
+                // Cursors are only ever compared with cursors into the same range.
+                static any_cursor_impl const &cast(interface_t const &that)
+                {
+                    RANGES_ASSERT(dynamic_cast<any_cursor_impl const *>(&that) != nullptr);
+                    return static_cast<any_cursor_impl const &>(that);
+                }
+                void prev_(concepts::BidirectionalIterator *)
+                {
+                    --it_;
+                }
+                void prev_(concepts::InputIterator *)
+                {
+                    RANGES_ASSERT(!"prev called on a cursor that isn't bidirectional");
+                }
+                void advance_(std::ptrdiff_t n, concepts::RandomAccessIterator *)
+                {
+                    it_ += static_cast<iterator_difference_t<I>>(n);
+                }
+                void advance_(std::ptrdiff_t, concepts::InputIterator *)
+                {
+                    RANGES_ASSERT(!"advance called on a cursor that isn't random-access");
+                }
+                std::ptrdiff_t distance_to_(any_cursor_impl const &that,
+                    concepts::RandomAccessIterator *) const
+                {
+                    return static_cast<std::ptrdiff_t>(that.it_ - it_);
+                }
+                std::ptrdiff_t distance_to_(any_cursor_impl const &,
+                    concepts::InputIterator *) const
+                {
+                    RANGES_ASSERT(!"distance_to called on a cursor that isn't random-access");
+                    return 0;
+                }
+                std::ptrdiff_t read_into_(value_type *out, std::ptrdiff_t n, std::true_type,
+                    concepts::SizedIteratorRange *)
+                {
+                    auto const d = static_cast<std::ptrdiff_t>(end_ - it_);
+                    n = n < d ? n : d;
+                    auto const last = ranges::next(it_, static_cast<iterator_difference_t<I>>(n));
+                    std::copy(it_, last, out);
+                    it_ = last;
+                    return n;
+                }
+                std::ptrdiff_t read_into_(value_type *out, std::ptrdiff_t n, std::true_type,
+                    concepts::IteratorRange *)
+                {
+                    std::ptrdiff_t i = 0;
+                    for(; i != n && it_ != end_; ++i, ++it_)
+                        out[i] = *it_;
+                    return i;
+                }
+                template<typename Concept>
+                std::ptrdiff_t read_into_(value_type *, std::ptrdiff_t, std::false_type, Concept)
+                {
+                    RANGES_ASSERT(!"read_into requires an assignable value type");
+                    return 0;
+                }
             public:
-                using single_pass = std::true_type;
-                any_input_cursor() = default;
-                template<typename Rng,
-                         CONCEPT_REQUIRES_(InputIterable<Rng>() &&
-                                           Same<Ref, range_reference_t<Rng>>())>
-                any_input_cursor(Rng &&rng, begin_tag)
-                  : ptr_{new any_input_cursor_impl<range_iterator_t<Rng>>{begin(rng)}}
-                {}
-                any_input_cursor(any_input_cursor &&) = default;
-                any_input_cursor(any_input_cursor &that)
-                  : ptr_{that.ptr_->clone()}
-                {}
-                any_input_cursor(any_input_cursor const &that)
-                  : ptr_{that.ptr_->clone()}
+                any_cursor_impl() = default;
+                any_cursor_impl(I it, S end)
+                  : it_(std::move(it)), end_(std::move(end))
                 {}
-                any_input_cursor &operator=(any_input_cursor &&) = default;
-                any_input_cursor &operator=(any_input_cursor const &that)
+                iterator_reference_t<I> current() const override
                 {
-                    ptr_.reset(that.ptr_->clone());
-                    return *this;
+                    return *it_;
                 }
-                Ref current() const
+                bool equal(interface_t const &that) const override
                 {
-                    return ptr_->current();
+                    return any_cursor_impl::cast(that).it_ == it_;
                 }
-                bool equal(any_input_cursor const &that) const
+                bool done() const override
                 {
-                    return ptr_->equal(*that.ptr_);
+                    return it_ == end_;
                 }
-                void next()
+                void next() override
                 {
-                    ptr_->next();
+                    ++it_;
+                }
+                void prev() override
+                {
+                    prev_(iterator_concept<I>());
+                }
+                void advance(std::ptrdiff_t n) override
+                {
+                    advance_(n, iterator_concept<I>());
+                }
+                std::ptrdiff_t distance_to(interface_t const &that) const override
+                {
+                    return distance_to_(any_cursor_impl::cast(that), iterator_concept<I>());
+                }
+                std::ptrdiff_t next_n(std::ptrdiff_t n) override
+                {
+                    auto const d = static_cast<iterator_difference_t<I>>(n);
+                    return static_cast<std::ptrdiff_t>(d - advance_bounded(it_, d, end_));
+                }
+                std::ptrdiff_t read_into(value_type *out, std::ptrdiff_t n) override
+                {
+                    return read_into_(out, n,
+                        std::is_assignable<value_type &, iterator_reference_t<I>>{},
+                        sized_iterator_range_concept<I, S>());
                 }
             };
 
-            template<typename Ref>
-            struct any_input_sentinel
+            template<typename Ref, typename Cat>
+            struct any_cursor
             {
             private:
-                std::unique_ptr<any_input_sentinel_interface<Ref>> ptr_;
+                any_ptr<any_cursor_interface<Ref>> ptr_;
+                template<typename Rng>
+                static range_iterator_t<Rng> end_of(Rng &rng)
+                {
+                    auto it = begin(rng);
+                    ranges::advance_to(it, end(rng));
+                    return it;
+                }
             public:
-                any_input_sentinel() = default;
+                using single_pass = meta::not_<any_is_multi_pass<Cat>>;
+                using value_type = meta::eval<std::decay<Ref>>;
+                struct mixin
+                  : basic_mixin<any_cursor>
+                {
+                    mixin() = default;
+                    mixin(any_cursor pos)
+                      : basic_mixin<any_cursor>{std::move(pos)}
+                    {}
+                    /// Advances past up to \c n elements, stopping early at the end of
+                    /// the range, with a single indirect call. Returns how many
+                    /// elements were skipped.
+                    std::ptrdiff_t next_n(std::ptrdiff_t n)
+                    {
+                        return this->get().ptr_->next_n(n);
+                    }
+                    /// Copies up to \c n elements into \c out and advances past them,
+                    /// with a single indirect call. Returns how many were copied.
+                    std::ptrdiff_t read_into(value_type *out, std::ptrdiff_t n)
+                    {
+                        return this->get().ptr_->read_into(out, n);
+                    }
+                };
+                any_cursor() = default;
                 template<typename Rng,
-                         CONCEPT_REQUIRES_(InputIterable<Rng>() &&
+                         CONCEPT_REQUIRES_(AnyErasable<Rng, Cat>() &&
                                            Same<Ref, range_reference_t<Rng>>())>
-                any_input_sentinel(Rng &&rng, end_tag)
-                  : ptr_{new any_input_sentinel_impl<range_sentinel_t<Rng>, range_iterator_t<Rng>>{end(rng)}}
-                {}
-                any_input_sentinel(any_input_sentinel &&) = default;
-                any_input_sentinel(any_input_sentinel &that)
-                  : ptr_{that.ptr_->clone()}
+                any_cursor(Rng &&rng, begin_tag)
+                  : ptr_{meta::id<any_cursor_impl<range_iterator_t<Rng>,
+                        range_sentinel_t<Rng>>>{}, begin(rng), end(rng)}
                 {}
-                any_input_sentinel(any_input_sentinel const &that)
-                  : ptr_{that.ptr_->clone()}
+                // Constant-time only for bounded or sized ranges.
+                template<typename Rng,
+                         CONCEPT_REQUIRES_(AnyErasable<Rng, Cat>() &&
+                                           Same<Ref, range_reference_t<Rng>>())>
+                any_cursor(Rng &&rng, end_tag)
+                  : ptr_{meta::id<any_cursor_impl<range_iterator_t<Rng>,
+                        range_sentinel_t<Rng>>>{}, any_cursor::end_of(rng), end(rng)}
                 {}
-                any_input_sentinel &operator=(any_input_sentinel &&) = default;
-                any_input_sentinel &operator=(any_input_sentinel const &that)
+                Ref current() const
                 {
-                    ptr_.reset(that.ptr_->clone());
-                    return *this;
+                    return ptr_->current();
                 }
-                bool equal(any_input_cursor<Ref> const &that) const
+                bool equal(any_cursor const &that) const
                 {
                     return ptr_->equal(*that.ptr_);
                 }
+                bool done() const
+                {
+                    return ptr_->done();
+                }
                 void next()
                 {
                     ptr_->next();
                 }
+                CONCEPT_REQUIRES(any_is_bidirectional<Cat>())
+                void prev()
+                {
+                    ptr_->prev();
+                }
+                CONCEPT_REQUIRES(any_is_random_access<Cat>())
+                void advance(std::ptrdiff_t n)
+                {
+                    ptr_->advance(n);
+                }
+                CONCEPT_REQUIRES(any_is_random_access<Cat>())
+                std::ptrdiff_t distance_to(any_cursor const &that) const
+                {
+                    return ptr_->distance_to(*that.ptr_);
+                }
             };
 
-            template<typename Ref>
-            struct any_input_range_interface
+            template<typename Ref, typename Cat>
+            struct any_range_interface
             {
-                virtual ~any_input_range_interface() {}
-                virtual any_input_cursor<Ref> begin_cursor() const = 0;
-                virtual any_input_sentinel<Ref> end_cursor() const = 0;
-                virtual any_input_range_interface *clone() const = 0;
+                using pointer = meta::eval<std::add_pointer<Ref>>;
+                virtual ~any_range_interface() {}
+                virtual any_cursor<Ref, Cat> begin_cursor() const = 0;
+                virtual any_cursor<Ref, Cat> end_cursor() const = 0;
+                // The address of the first element if the elements are contiguous
+                // in memory, else null.
+                virtual pointer data() const = 0;
+                virtual any_range_interface *clone(any_small_buffer &) const = 0;
+                virtual any_range_interface *move(any_small_buffer &) noexcept = 0;
             };
 
-            template<typename Rng>
-            struct any_input_range_impl
-              : any_input_range_interface<range_reference_t<Rng>>
+            template<typename Rng, typename Cat>
+            struct any_range_impl
+              : any_cloneable<any_range_impl<Rng, Cat>,
+                    any_range_interface<range_reference_t<Rng>, Cat>>
             {
             private:
+                using pointer = meta::eval<std::add_pointer<range_reference_t<Rng>>>;
                 view::all_t<Rng> rng_;
+                pointer data_(std::true_type) const
+                {
+                    auto it = begin(rng_);
+                    return it == end(rng_) ? nullptr : std::addressof(*it);
+                }
+                pointer data_(std::false_type) const
+                {
+                    return nullptr;
+                }
             public:
-                any_input_range_impl() = default;
-                any_input_range_impl(Rng && rng)
+                any_range_impl() = default;
+                any_range_impl(Rng && rng)
                   : rng_{view::all(std::forward<Rng>(rng))}
                 {}
-                any_input_cursor<range_reference_t<Rng>> begin_cursor() const override
+                any_cursor<range_reference_t<Rng>, Cat> begin_cursor() const override
                 {
                     return {rng_, begin_tag{}};
                 }
-                any_input_sentinel<range_reference_t<Rng>> end_cursor() const override
+                any_cursor<range_reference_t<Rng>, Cat> end_cursor() const override
                 {
                     return {rng_, end_tag{}};
                 }
-                any_input_range_interface<range_reference_t<Rng>> *clone() const override
+                pointer data() const override
                 {
-                    return new any_input_range_impl<view::all_t<Rng>>{static_cast<view::all_t<Rng>>(rng_)};
+                    return data_(any_is_contiguous<Rng>{});
                 }
             };
         }
         /// \endcond
 
-        /// \brief A type-erased InputRange
+        /// \brief A type-erased range of the iterator category \c Cat
+        ///
+        /// Small ranges and cursors are stored inline rather than on the heap.
+        /// Iterators have \c next_n and \c read_into members that process a
+        /// block of elements per indirect call. Bidirectional and random-access
+        /// ranges that aren't infinite are bounded; producing their end is only
+        /// constant-time when the erased range is bounded or sized. A
+        /// random-access range whose elements are contiguous in memory also
+        /// exposes them through \c data().
         /// \ingroup group-views
-        template<typename Ref, bool Inf = false>
-        struct any_input_range
-          : range_facade<any_input_range<Ref, Inf>, Inf>
+        template<typename Ref, typename Cat, bool Inf = false>
+        struct any_range
+          : range_facade<any_range<Ref, Cat, Inf>, Inf>
         {
         private:
             friend range_access;
-            std::unique_ptr<detail::any_input_range_interface<Ref>> ptr_;
-            detail::any_input_cursor<Ref> begin_cursor() const
+            detail::any_ptr<detail::any_range_interface<Ref, Cat>> ptr_;
+            detail::any_cursor<Ref, Cat> begin_cursor() const
             {
                 return ptr_->begin_cursor();
             }
-            detail::any_input_sentinel<Ref> end_cursor() const
+            CONCEPT_REQUIRES(detail::any_is_bidirectional<Cat>() && !Inf)
+            detail::any_cursor<Ref, Cat> end_cursor() const
             {
                 return ptr_->end_cursor();
             }
+            CONCEPT_REQUIRES(!detail::any_is_bidirectional<Cat>() || Inf)
+            default_sentinel end_cursor() const
+            {
+                return {};
+            }
         public:
-            any_input_range() = default;
+            any_range() = default;
             template<typename Rng,
-                CONCEPT_REQUIRES_(InputIterable<Rng>() &&
+                CONCEPT_REQUIRES_(detail::AnyErasable<Rng, Cat>() &&
                                   Same<Ref, range_reference_t<Rng>>())>
-            any_input_range(Rng && rng)
-              : ptr_{new detail::any_input_range_impl<Rng>{std::forward<Rng>(rng)}}
+            any_range(Rng && rng)
+              : ptr_{meta::id<detail::any_range_impl<Rng, Cat>>{}, std::forward<Rng>(rng)}
             {
                 static_assert(Inf == is_infinite<Rng>::value,
                     "Rng finiteness does not match the Inf template parameter");
             }
-            any_input_range(any_input_range &&) = default;
-            any_input_range(any_input_range &that)
-              : ptr_{that.ptr_->clone()}
+            any_range(any_range &&) = default;
+            any_range(any_range &that)
+              : ptr_{that.ptr_}
             {}
-            any_input_range(any_input_range const &that)
-              : ptr_{that.ptr_->clone()}
+            any_range(any_range const &that)
+              : ptr_{that.ptr_}
             {}
-            any_input_range &operator=(any_input_range &&) = default;
-            any_input_range &operator=(any_input_range const &that)
+            any_range &operator=(any_range &&) = default;
+            any_range &operator=(any_range const &) = default;
+            /// A pointer to the first element if the erased range is contiguous
+            /// and not empty, else null.
+            CONCEPT_REQUIRES(detail::any_is_random_access<Cat>())
+            meta::eval<std::add_pointer<Ref>> data() const
             {
-                ptr_.reset(that.ptr_->clone());
-                return *this;
+                return ptr_->data();
             }
         };
+
+        /// \brief A type-erased InputRange
+        /// \ingroup group-views
+        template<typename Ref, bool Inf = false>
+        using any_input_range = any_range<Ref, ranges::input_iterator_tag, Inf>;
+
+        /// \brief A type-erased ForwardRange
+        /// \ingroup group-views
+        template<typename Ref, bool Inf = false>
+        using any_forward_range = any_range<Ref, ranges::forward_iterator_tag, Inf>;
+
+        /// \brief A type-erased BidirectionalRange
+        /// \ingroup group-views
+        template<typename Ref, bool Inf = false>
+        using any_bidirectional_range = any_range<Ref, ranges::bidirectional_iterator_tag, Inf>;
+
+        /// \brief A type-erased RandomAccessRange
+        /// \ingroup group-views
+        template<typename Ref, bool Inf = false>
+        using any_random_access_range = any_range<Ref, ranges::random_access_iterator_tag, Inf>;
     }
 }
 
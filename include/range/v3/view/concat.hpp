@@ -206,6 +206,10 @@ namespace ranges
                 cursor(concat_view const &rng, end_tag)
                   : rng_(&rng), its_{meta::size_t<cranges-1>{}, end(std::get<cranges-1>(rng.rngs_))}
                 {}
+                template<std::size_t N, typename I>
+                cursor(concat_view const &rng, meta::size_t<N> which, I it)
+                  : rng_(&rng), its_{which, std::move(it)}
+                {}
                 reference current() const
                 {
                     // Kind of a dumb implementation. Surely there's a better way.
@@ -264,6 +268,31 @@ namespace ranges
             {
                 return {*this, end_tag{}};
             }
+            // Segmented iteration; see detail::is_segmented. Only offered when every
+            // range has the concatenation's reference type, so that algorithms see
+            // the same argument types either way.
+            template<typename Fun, typename D = concat_view,
+                CONCEPT_REQUIRES_(meta::and_c<(bool)Same<range_reference_t<Rngs const>,
+                    typename cursor::reference>()...>::value)>
+            range_iterator_t<D const> for_each_segment(Fun &fun) const
+            {
+                return this->for_each_segment_(fun, meta::size_t<0>{});
+            }
+            template<typename Fun, std::size_t N, typename D = concat_view>
+            range_iterator_t<D const> for_each_segment_(Fun &fun, meta::size_t<N> which) const
+            {
+                auto it = begin(std::get<N>(rngs_));
+                if(fun(it, end(std::get<N>(rngs_))))
+                    return cursor{*this, which, std::move(it)};
+                return this->for_each_segment_(fun, meta::size_t<N + 1>{});
+            }
+            template<typename Fun, typename D = concat_view>
+            range_iterator_t<D const> for_each_segment_(Fun &fun, meta::size_t<cranges - 1> which) const
+            {
+                auto it = begin(std::get<cranges - 1>(rngs_));
+                fun(it, end(std::get<cranges - 1>(rngs_)));
+                return cursor{*this, which, std::move(it)};
+            }
         public:
             concat_view() = default;
             explicit concat_view(Rngs &&...rngs)
@@ -0,0 +1,156 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_DELTA_DECODE_HPP
+#define RANGES_V3_VIEW_DELTA_DECODE_HPP
+
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/varint.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The integers of type \c T that `delta_encode` wrote as bytes to \c Rng,
+        /// read one varint at a time as the view is walked.
+        template<typename T, typename Rng>
+        struct delta_decode_view
+          : range_facade<delta_decode_view<T, Rng>>
+        {
+        private:
+            friend range_access;
+            using U = meta::eval<std::make_unsigned<T>>;
+            view::all_t<Rng> rng_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, view::all_t<Rng>>;
+                range_iterator_t<base_t> it_;
+                range_sentinel_t<base_t> end_;
+                T value_;
+                bool done_;
+            public:
+                using single_pass = SinglePass<range_iterator_t<base_t>>;
+                cursor() = default;
+                cursor(range_iterator_t<base_t> it, range_sentinel_t<base_t> end)
+                  : it_(std::move(it)), end_(std::move(end)), value_(0), done_(false)
+                {
+                    this->next();
+                }
+                T current() const
+                {
+                    return value_;
+                }
+                void next()
+                {
+                    if(it_ == end_)
+                        done_ = true;
+                    else
+                        value_ = detail::undelta(detail::varint_read<U>(it_, end_), value_);
+                }
+                bool done() const
+                {
+                    return done_;
+                }
+                // The last value has been read once it_ reaches the end, but not
+                // stepped past.
+                bool equal(cursor const &that) const
+                {
+                    return it_ == that.it_ && done_ == that.done_;
+                }
+            };
+            CONCEPT_REQUIRES(!Iterable<view::all_t<Rng> const>())
+            cursor<false> begin_cursor()
+            {
+                return {begin(rng_), end(rng_)};
+            }
+            CONCEPT_REQUIRES(Iterable<view::all_t<Rng> const>())
+            cursor<true> begin_cursor() const
+            {
+                return {begin(rng_), end(rng_)};
+            }
+        public:
+            delta_decode_view() = default;
+            explicit delta_decode_view(Rng && rng)
+              : rng_(view::all(std::forward<Rng>(rng)))
+            {}
+        };
+
+        namespace view
+        {
+            template<typename T>
+            struct delta_decode_fn
+            {
+                template<typename Rng, typename V = range_value_t<Rng>>
+                using Concept = meta::and_<
+                    InputIterable<Rng>,
+                    detail::is_delta_codable<T>,
+                    meta::bool_<std::is_integral<V>::value && sizeof(V) == 1>>;
+
+                template<typename Rng, CONCEPT_REQUIRES_(Concept<Rng>())>
+                delta_decode_view<T, Rng> operator()(Rng && rng) const
+                {
+                    return delta_decode_view<T, Rng>{std::forward<Rng>(rng)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, CONCEPT_REQUIRES_(!Concept<Rng>())>
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The argument passed to view::delta_decode must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(detail::is_delta_codable<T>(),
+                        "view::delta_decode decodes integers of a type other than bool.");
+                    CONCEPT_ASSERT_MSG(std::is_integral<range_value_t<Rng>>() &&
+                        sizeof(range_value_t<Rng>) == 1,
+                        "The argument passed to view::delta_decode must be a range of bytes.");
+                }
+            #endif
+            };
+
+            /// \relates delta_decode_fn
+            /// TODO use a variable template here when they're available
+            template<typename T>
+            view<delta_decode_fn<T>> delta_decode()
+            {
+                return {};
+            }
+
+            /// \relates delta_decode_fn
+            template<typename T, typename Rng>
+            auto delta_decode(Rng && rng) ->
+                decltype(delta_decode_fn<T>{}(std::forward<Rng>(rng)))
+            {
+                return delta_decode_fn<T>{}(std::forward<Rng>(rng));
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
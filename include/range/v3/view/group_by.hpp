@@ -23,25 +23,55 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_facade.hpp>
 #include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/static_const.hpp>
-#include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/view/view.hpp>
-#include <range/v3/view/take_while.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Where a group_by_view over an input range is in the underlying range,
+            // and a copy of the current group's first element to compare the rest
+            // of the group against.
+            template<typename Rng>
+            struct group_by_input
+            {
+                range_iterator_t<Rng> it_;
+                range_sentinel_t<Rng> last_;
+                optional<range_value_t<Rng>> first_value_;
+                bool at_first_;
+            };
+
+            struct group_by_no_input
+            {};
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
+
+        /// Groups of consecutive elements that are all equivalent to the group's
+        /// first element. Over forward ranges the end of each group is found once,
+        /// when the cursor reaches it, and each group is a subrange of the input,
+        /// sized if the input is random-access. Over input ranges the groups read
+        /// from the underlying range as they are iterated, and moving to the next
+        /// group skips what is left of the current one.
         template<typename Rng, typename Fun>
         struct group_by_view
           : range_facade<group_by_view<Rng, Fun>>
         {
         private:
             friend range_access;
+            using input_t = meta::if_<ForwardIterable<Rng>,
+                detail::group_by_no_input, detail::group_by_input<Rng>>;
             view::all_t<Rng> rng_;
             semiregular_invokable_t<Fun> fun_;
+            input_t in_;
 
             template<bool IsConst>
             struct cursor
@@ -49,10 +79,11 @@ namespace ranges
             private:
                 friend range_access; friend group_by_view;
                 range_iterator_t<Rng> cur_;
+                range_iterator_t<Rng> next_cur_;
                 range_sentinel_t<Rng> last_;
                 semiregular_invokable_ref_t<Fun, IsConst> fun_;
 
-                struct take_while_pred
+                struct pred
                 {
                     range_iterator_t<Rng> first_;
                     semiregular_invokable_ref_t<Fun, IsConst> fun_;
@@ -61,14 +92,20 @@ namespace ranges
                         return fun_(*first_, ref);
                     }
                 };
-                take_while_view<range<range_iterator_t<Rng>, range_sentinel_t<Rng>>, take_while_pred>
-                current() const
+                range_iterator_t<Rng> group_end() const
                 {
-                    return {{cur_, last_}, {cur_, fun_}};
+                    if(cur_ == last_)
+                        return cur_;
+                    return find_if_not(ranges::next(cur_), last_, pred{cur_, fun_});
+                }
+                range<range_iterator_t<Rng>> current() const
+                {
+                    return {cur_, next_cur_};
                 }
                 void next()
                 {
-                    cur_ = next_bounded(adjacent_find(cur_, last_, not_(std::ref(fun_))), 1, last_);
+                    cur_ = next_cur_;
+                    next_cur_ = this->group_end();
                 }
                 bool done() const
                 {
@@ -80,28 +117,124 @@ namespace ranges
                 }
                 cursor(semiregular_invokable_ref_t<Fun, IsConst> fun, range_iterator_t<Rng> first,
                     range_sentinel_t<Rng> last)
-                  : cur_(first), last_(last), fun_(fun)
-                {}
+                  : cur_(first), next_cur_(first), last_(last), fun_(fun)
+                {
+                    next_cur_ = this->group_end();
+                }
             public:
                 cursor() = default;
             };
-            CONCEPT_REQUIRES(!Invokable<Fun const, range_common_reference_t<Rng>,
-                range_common_reference_t<Rng>>())
+
+            struct group_cursor
+            {
+            private:
+                group_by_view *rng_;
+            public:
+                group_cursor() = default;
+                explicit group_cursor(group_by_view &rng)
+                  : rng_(&rng)
+                {}
+                range_reference_t<Rng> current() const
+                {
+                    return *rng_->in_.it_;
+                }
+                void next()
+                {
+                    rng_->in_.at_first_ = false;
+                    ++rng_->in_.it_;
+                }
+                bool done() const
+                {
+                    return rng_->group_done();
+                }
+            };
+            // One group of an input range.
+            struct group
+              : range_facade<group>
+            {
+            private:
+                friend range_access;
+                group_by_view *rng_;
+                group_cursor begin_cursor() const
+                {
+                    return group_cursor{*rng_};
+                }
+            public:
+                group() = default;
+                explicit group(group_by_view &rng)
+                  : rng_(&rng)
+                {}
+            };
+            struct input_cursor
+            {
+            private:
+                group_by_view *rng_;
+            public:
+                input_cursor() = default;
+                explicit input_cursor(group_by_view &rng)
+                  : rng_(&rng)
+                {}
+                group current() const
+                {
+                    return group{*rng_};
+                }
+                void next()
+                {
+                    rng_->next_group();
+                }
+                bool done() const
+                {
+                    return rng_->in_.it_ == rng_->in_.last_;
+                }
+            };
+            bool group_done()
+            {
+                return in_.it_ == in_.last_ ||
+                    (!in_.at_first_ && !fun_(*in_.first_value_, *in_.it_));
+            }
+            void start_group()
+            {
+                in_.at_first_ = true;
+                if(in_.it_ != in_.last_)
+                    in_.first_value_ = *in_.it_;
+            }
+            void next_group()
+            {
+                while(!this->group_done())
+                {
+                    in_.at_first_ = false;
+                    ++in_.it_;
+                }
+                this->start_group();
+            }
+
+            CONCEPT_REQUIRES(ForwardIterable<Rng>() &&
+                !Invokable<Fun const, range_common_reference_t<Rng>,
+                    range_common_reference_t<Rng>>())
             cursor<false> begin_cursor()
             {
                 return {fun_, ranges::begin(rng_), ranges::end(rng_)};
             }
-            CONCEPT_REQUIRES(Invokable<Fun const, range_common_reference_t<Rng>,
-                range_common_reference_t<Rng>>())
+            CONCEPT_REQUIRES(ForwardIterable<Rng>() &&
+                Invokable<Fun const, range_common_reference_t<Rng>,
+                    range_common_reference_t<Rng>>())
             cursor<true> begin_cursor() const
             {
                 return {fun_, ranges::begin(rng_), ranges::end(rng_)};
             }
+            CONCEPT_REQUIRES(!ForwardIterable<Rng>())
+            input_cursor begin_cursor()
+            {
+                in_.it_ = ranges::begin(rng_);
+                in_.last_ = ranges::end(rng_);
+                this->start_group();
+                return input_cursor{*this};
+            }
         public:
             group_by_view() = default;
             group_by_view(Rng && rng, Fun fun)
               : rng_(view::all(std::forward<Rng>(rng)))
-              , fun_(std::move(fun))
+              , fun_(std::move(fun)), in_{}
             {}
         };
 
@@ -120,7 +253,7 @@ namespace ranges
             public:
                 template<typename Rng, typename Fun>
                 using Concept = meta::and_<
-                    ForwardIterable<Rng>,
+                    InputIterable<Rng>,
                     IndirectInvokablePredicate<Fun, range_iterator_t<Rng>,
                         range_iterator_t<Rng>>>;
 
@@ -136,9 +269,9 @@ namespace ranges
                     CONCEPT_REQUIRES_(!Concept<Rng, Fun>())>
                 void operator()(Rng &&, Fun) const
                 {
-                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
                         "The object on which view::group_by operates must be a model of the "
-                        "ForwardIterable concept.");
+                        "InputIterable concept.");
                     CONCEPT_ASSERT_MSG(IndirectInvokablePredicate<Fun, range_iterator_t<Rng>,
                         range_iterator_t<Rng>>(),
                         "The function passed to view::group_by must be callable with two arguments "
@@ -34,6 +34,22 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Whether the current inner range of a join over Rng can be fetched
+            // again from the outer iterator whenever it is needed.
+            template<typename Rng>
+            using join_by_reference = meta::and_<
+                Iterable<Rng>,
+                meta::lazy_apply<
+                    meta::compose<
+                        meta::quote<std::is_reference>,
+                        meta::quote<range_reference_t>>,
+                    Rng>>;
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
 
@@ -51,6 +67,8 @@ namespace ranges
             friend range_access;
             view::all_t<range_value_t<Rng>> cur_;
 
+            // Joins ranges that the outer range yields by value. The current inner
+            // range is kept in the view, so iteration is single-pass.
             struct adaptor : adaptor_base
             {
             private:
@@ -80,6 +98,9 @@ namespace ranges
                 adaptor(join_view &rng)
                   : rng_(&rng), it_{}
                 {}
+                adaptor(join_view &rng, range_iterator_t<range_value_t<Rng>> it)
+                  : rng_(&rng), it_(std::move(it))
+                {}
                 range_iterator_t<Rng> begin(join_view &)
                 {
                     auto it = ranges::begin(rng_->mutable_base());
@@ -113,10 +134,83 @@ namespace ranges
                     return *it_;
                 }
             };
+            // Joins ranges that the outer range yields by reference. The inner range
+            // is fetched from the outer iterator as needed, so all the state is in
+            // the cursor: the join is multi-pass, and const-iterable when the outer
+            // range is.
+            template<bool IsConst>
+            struct ref_adaptor : adaptor_base
+            {
+            private:
+                using view_t = meta::apply<meta::add_const_if_c<IsConst>, join_view>;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, view::all_t<Rng>>;
+                using outer_t = range_iterator_t<base_t>;
+                using inner_rng_t = range_reference_t<base_t>;
+                using inner_t = range_iterator_t<inner_rng_t>;
+                view_t *rng_;
+                inner_t it_;
+                using adaptor_base::advance;
+                using adaptor_base::distance_to;
+                void satisfy(outer_t &it)
+                {
+                    auto const end = ranges::end(rng_->base());
+                    while(it_ == ranges::end(*it))
+                    {
+                        if(++it == end)
+                        {
+                            it_ = inner_t{};
+                            break;
+                        }
+                        it_ = ranges::begin(*it);
+                    }
+                }
+            public:
+                using single_pass = SinglePass<inner_t>;
+                ref_adaptor() = default;
+                ref_adaptor(view_t &rng, inner_t it = inner_t{})
+                  : rng_(&rng), it_(std::move(it))
+                {}
+                outer_t begin(view_t &)
+                {
+                    auto it = ranges::begin(rng_->base());
+                    if(it != ranges::end(rng_->base()))
+                    {
+                        it_ = ranges::begin(*it);
+                        satisfy(it);
+                    }
+                    return it;
+                }
+                bool equal(outer_t const &it, outer_t const &other_it,
+                    ref_adaptor const &other_adapt) const
+                {
+                    return it == other_it && it_ == other_adapt.it_;
+                }
+                void next(outer_t &it)
+                {
+                    ++it_;
+                    satisfy(it);
+                }
+                CONCEPT_REQUIRES(BidirectionalIterator<outer_t>() &&
+                    BidirectionalIterator<inner_t>() && BoundedIterable<inner_rng_t>())
+                void prev(outer_t &it)
+                {
+                    if(it == ranges::end(rng_->base()))
+                        it_ = ranges::end(*--it);
+                    while(it_ == ranges::begin(*it))
+                        it_ = ranges::end(*--it);
+                    --it_;
+                }
+                auto current(outer_t const &) const -> decltype(*it_)
+                {
+                    return *it_;
+                }
+            };
+            CONCEPT_REQUIRES(!detail::join_by_reference<view::all_t<Rng>>())
             adaptor begin_adaptor()
             {
                 return {*this};
             }
+            CONCEPT_REQUIRES(!detail::join_by_reference<view::all_t<Rng>>())
             adaptor end_adaptor()
             {
 #if __cplusplus > 201103L
@@ -125,7 +219,73 @@ namespace ranges
                 return {};
 #endif
             }
-            // TODO: could support const iteration if range_reference_t<Rng> is a true reference.
+            CONCEPT_REQUIRES(detail::join_by_reference<view::all_t<Rng>>())
+            ref_adaptor<false> begin_adaptor()
+            {
+                return {*this};
+            }
+            CONCEPT_REQUIRES(detail::join_by_reference<view::all_t<Rng>>())
+            ref_adaptor<false> end_adaptor()
+            {
+                return {*this};
+            }
+            CONCEPT_REQUIRES(detail::join_by_reference<view::all_t<Rng> const>())
+            ref_adaptor<true> begin_adaptor() const
+            {
+                return {*this};
+            }
+            CONCEPT_REQUIRES(detail::join_by_reference<view::all_t<Rng> const>())
+            ref_adaptor<true> end_adaptor() const
+            {
+                return {*this};
+            }
+            template<bool IsConst, typename Fun, typename Self>
+            static range_iterator_t<Self> for_each_ref_segment(Self &self, Fun &fun)
+            {
+                auto it = ranges::begin(self.base());
+                auto const end = ranges::end(self.base());
+                for(; it != end; ++it)
+                {
+                    auto &&rng = *it;
+                    auto inner = ranges::begin(rng);
+                    if(fun(inner, ranges::end(rng)))
+                        return adaptor_cursor_t<Self>{std::move(it),
+                            ref_adaptor<IsConst>{self, std::move(inner)}};
+                }
+                return adaptor_cursor_t<Self>{std::move(it), ref_adaptor<IsConst>{self}};
+            }
+            // Segmented iteration; see detail::is_segmented.
+            template<typename Fun, typename D = join_view,
+                CONCEPT_REQUIRES_(detail::join_by_reference<view::all_t<Rng>>())>
+            range_iterator_t<D> for_each_segment(Fun &fun)
+            {
+                return join_view::for_each_ref_segment<false>(*this, fun);
+            }
+            template<typename Fun, typename D = join_view,
+                CONCEPT_REQUIRES_(detail::join_by_reference<view::all_t<Rng> const>())>
+            range_iterator_t<D const> for_each_segment(Fun &fun) const
+            {
+                return join_view::for_each_ref_segment<true>(*this, fun);
+            }
+            template<typename Fun, typename D = join_view,
+                CONCEPT_REQUIRES_(!detail::join_by_reference<view::all_t<Rng>>())>
+            range_iterator_t<D> for_each_segment(Fun &fun)
+            {
+                auto it = ranges::begin(this->mutable_base());
+                auto const end = ranges::end(this->mutable_base());
+                for(; it != end; ++it)
+                {
+                    cur_ = view::all(*it);
+                    range_iterator_t<range_value_t<Rng>> inner = ranges::begin(cur_);
+                    if(fun(inner, ranges::end(cur_)))
+                        return adaptor_cursor_t<D>{std::move(it), adaptor{*this, std::move(inner)}};
+                }
+#if __cplusplus > 201103L
+                return adaptor_cursor_t<D>{std::move(it), adaptor{*this}};
+#else
+                return adaptor_cursor_t<D>{std::move(it), adaptor{}};
+#endif
+            }
         public:
             join_view() = default;
             explicit join_view(Rng &&rng)
@@ -256,7 +416,7 @@ namespace ranges
               : range_adaptor_t<join_view>{std::forward<Rng>(rng)}
               , cur_{}, val_(view::all(std::forward<ValRng>(val)))
             {}
-            CONCEPT_REQUIRES(!is_infinite<Rng>() && ForwardIterable<Rng>() &&
+            CONCEPT_REQUIRES(!is_infinite<Rng>() && ForwardIterable<Rng>() && SizedIterable<Rng>() &&
                              SizedIterable<range_value_t<Rng>>() && SizedIterable<ValRng>())
             size_t_ size() const
             {
@@ -14,16 +14,21 @@
 #ifndef RANGES_V3_VIEW_REMOVE_IF_HPP
 #define RANGES_V3_VIEW_REMOVE_IF_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_block.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/execution_policy.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
@@ -33,27 +38,123 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            inline int ctz64(std::uint64_t bits)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return __builtin_ctzll(bits);
+#else
+                int n = 0;
+                for(; !(bits & 1u); bits >>= 1)
+                    ++n;
+                return n;
+#endif
+            }
+
+            // How a remove_if_view iterator finds the next element to keep. With
+            // unseq, over a random-access range of numbers, the predicate is run on
+            // the next 64 elements at a time in a loop with no branches, and the
+            // elements to keep are marked in a bitmask, with the current position in
+            // bit 0. Stepping from one set bit to the next with ctz then costs no
+            // mispredicted branches, however the elements happen to be mixed.
+            template<bool Batched>
+            struct filter_mask
+            {
+            private:
+                mutable std::uint64_t bits_ = 0;
+                mutable std::ptrdiff_t size_ = 0;
+            public:
+                template<typename I, typename S, typename Pred>
+                void satisfy(I &it, S const &end, Pred &pred) const
+                {
+                    while(bits_ == 0)
+                    {
+                        it += static_cast<iterator_difference_t<I>>(size_);
+                        auto const left = end - it;
+                        size_ = left < 64 ? static_cast<std::ptrdiff_t>(left) : 64;
+                        if(size_ == 0)
+                            return;
+                        std::uint64_t bits = 0;
+                        for(std::ptrdiff_t i = 0; i < size_; ++i)
+                            bits |= static_cast<std::uint64_t>(
+                                !pred(it[static_cast<iterator_difference_t<I>>(i)])) << i;
+                        bits_ = bits;
+                    }
+                    int const skip = detail::ctz64(bits_);
+                    it += skip;
+                    bits_ >>= skip;
+                    size_ -= skip;
+                }
+                // The iterator is about to move past the current position.
+                void pop_front() const
+                {
+                    if(size_ != 0)
+                    {
+                        bits_ >>= 1;
+                        --size_;
+                    }
+                }
+                void clear() const
+                {
+                    bits_ = 0;
+                    size_ = 0;
+                }
+            };
+
+            template<>
+            struct filter_mask<false>
+            {
+                template<typename I, typename S, typename Pred>
+                void satisfy(I &it, S const &end, Pred &pred) const
+                {
+                    it = find_if_not(std::move(it), end, std::ref(pred));
+                }
+                void pop_front() const
+                {}
+                void clear() const
+                {}
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
-        template<typename Rng, typename Pred>
+
+        /// The elements of \c Rng for which \c Pred is false. With \c Unseq, made
+        /// by `view::remove_if(unseq, pred)`, the iterators may call the predicate
+        /// on elements ahead of the ones they have reached, up to 64 at a time,
+        /// and in any order, so the predicate should be cheap and must have no
+        /// side effects that matter.
+        template<typename Rng, typename Pred, bool Unseq /*= false*/>
         struct remove_if_view
-          : range_adaptor<remove_if_view<Rng, Pred>, Rng>
+          : range_adaptor<remove_if_view<Rng, Pred, Unseq>, Rng>
         {
         private:
             friend range_access;
             semiregular_invokable_t<Pred> pred_;
             optional<range_iterator_t<Rng>> begin_;
 
+            // The predicate is only run ahead of the iterator when the caller
+            // asked for it with unseq; see detail::filter_mask.
+            using mask_t = detail::filter_mask<meta::and_<
+                meta::bool_<Unseq>,
+                RandomAccessIterable<Rng>,
+                SizedIteratorRange<range_iterator_t<Rng>, range_sentinel_t<Rng>>,
+                std::is_arithmetic<range_value_t<Rng>>>::value>;
+
             struct adaptor
               : adaptor_base
+              , private mask_t
             {
             private:
                 remove_if_view *rng_;
                 using adaptor_base::advance;
                 void satisfy(range_iterator_t<Rng> &it) const
                 {
-                    it = find_if_not(std::move(it), ranges::end(rng_->mutable_base()),
-                        std::ref(rng_->pred_));
+                    this->mask_t::satisfy(it, ranges::end(rng_->mutable_base()),
+                        rng_->pred_);
                 }
             public:
                 adaptor() = default;
@@ -72,11 +173,13 @@ namespace ranges
                 }
                 void next(range_iterator_t<Rng> &it) const
                 {
+                    this->pop_front();
                     this->satisfy(++it);
                 }
                 CONCEPT_REQUIRES(BidirectionalIterable<Rng>())
                 void prev(range_iterator_t<Rng> &it) const
                 {
+                    this->clear();
                     auto &&pred = rng_->pred_;
                     do --it; while(pred(*it));
                 }
@@ -91,6 +194,56 @@ namespace ranges
             {
                 return {*this};
             }
+            template<typename Sink>
+            struct push_fn
+            {
+                semiregular_invokable_t<Pred> &pred_;
+                Sink &sink_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return pred_(t) || sink_(std::forward<T>(t));
+                }
+            };
+            // Push iteration; see for_each_while.
+            template<typename Sink, typename D = remove_if_view>
+            range_iterator_t<D> for_each_while(Sink &sink)
+            {
+                push_fn<Sink> push{pred_, sink};
+                auto it = ranges::for_each_while(this->mutable_base(), push);
+                return adaptor_cursor_t<D>{std::move(it), adaptor{*this}};
+            }
+            template<typename Sink>
+            struct block_fn
+            {
+                semiregular_invokable_t<Pred> &pred_;
+                Sink &sink_;
+                template<typename T>
+                void operator()(T const *p, std::ptrdiff_t n) const
+                {
+                    // Copy every element and advance past the ones that are kept,
+                    // which the compiler turns into a loop with no branches.
+                    T buf[detail::block_size];
+                    std::ptrdiff_t m = 0;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                    {
+                        buf[m] = p[i];
+                        m += pred_(p[i]) ? 0 : 1;
+                    }
+                    if(m != 0)
+                        sink_(static_cast<T const *>(buf), m);
+                }
+            };
+            // Block iteration; see for_each_block.
+            template<typename Sink, typename D = remove_if_view,
+                CONCEPT_REQUIRES_(detail::is_blockable<ranges::base_range_t<D>>() &&
+                    Invokable<semiregular_invokable_t<Pred>,
+                        range_value_t<ranges::base_range_t<D>> const &>())>
+            void for_each_block(Sink &sink)
+            {
+                block_fn<Sink> block{pred_, sink};
+                ranges::for_each_block(this->mutable_base(), block);
+            }
         public:
             remove_if_view() = default;
             remove_if_view(remove_if_view &&that)
@@ -124,6 +277,16 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename Pred, bool Unseq>
+            struct block_filters<remove_if_view<Rng, Pred, Unseq>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct remove_if_fn
@@ -136,6 +299,13 @@ namespace ranges
                 (
                     make_pipeable(std::bind(remove_if, std::placeholders::_1, protect(std::move(pred))))
                 )
+                template<typename Pred>
+                static auto bind(remove_if_fn remove_if, unsequenced_policy policy, Pred pred)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(remove_if, std::placeholders::_1, policy,
+                        protect(std::move(pred))))
+                )
             public:
                 template<typename Rng, typename Pred>
                 using Concept = meta::and_<
@@ -149,7 +319,22 @@ namespace ranges
                 {
                     return {std::forward<Rng>(rng), std::move(pred)};
                 }
+                /// The predicate may be called on elements ahead of the iterators,
+                /// and in any order; see \c remove_if_view.
+                template<typename Rng, typename Pred,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>())>
+                remove_if_view<Rng, Pred, true>
+                operator()(Rng && rng, unsequenced_policy, Pred pred) const
+                {
+                    return {std::forward<Rng>(rng), std::move(pred)};
+                }
             #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Pred,
+                    CONCEPT_REQUIRES_(!Concept<Rng, Pred>())>
+                void operator()(Rng && rng, unsequenced_policy, Pred pred) const
+                {
+                    (*this)(std::forward<Rng>(rng), std::move(pred));
+                }
                 template<typename Rng, typename Pred,
                     CONCEPT_REQUIRES_(!Concept<Rng, Pred>())>
                 void operator()(Rng &&, Pred) const
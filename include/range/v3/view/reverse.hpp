@@ -98,7 +98,7 @@ namespace ranges
             }
         public:
             reverse_view() = default;
-            reverse_view(Rng && rng)
+            explicit reverse_view(Rng && rng)
               : range_adaptor_t<reverse_view>{std::forward<Rng>(rng)}
             {}
             CONCEPT_REQUIRES(SizedIterable<Rng>())
@@ -24,7 +24,9 @@
 #include <range/v3/range_facade.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/algorithm/find.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/indirect.hpp>
@@ -34,6 +36,26 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // A delimiter matcher may also provide search(cur, end), returning the
+            // position of the first match at or after cur (or end) and its length.
+            // split_view then skips to the next delimiter in one step rather than
+            // trying the matcher at every position.
+            template<typename Fun, typename I, typename S, typename = void>
+            struct has_split_search
+              : std::false_type
+            {};
+
+            template<typename Fun, typename I, typename S>
+            struct has_split_search<Fun, I, S,
+                void_t<decltype(std::declval<Fun &>().search(std::declval<I>(), std::declval<S>()))>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Fun>
@@ -50,10 +72,19 @@ namespace ranges
             {
             private:
                 friend range_access; friend split_view;
+                // Over a contiguous range the end of the current piece is found by
+                // next() and cached, so each piece is a range of pointers with an O(1)
+                // size and the delimiter is only searched for once.
+                using contiguous_ = is_contiguous_iterator<range_iterator_t<Rng>>;
+                using searchable_ = detail::has_split_search<
+                    semiregular_invokable_ref_t<Fun, IsConst>,
+                    range_iterator_t<Rng>, range_sentinel_t<Rng>>;
                 bool zero_;
                 range_iterator_t<Rng> cur_;
                 range_sentinel_t<Rng> last_;
                 semiregular_invokable_ref_t<Fun, IsConst> fun_;
+                range_iterator_t<Rng> end_;
+                range_difference_t<Rng> len_;
 
                 struct search_pred
                 {
@@ -67,32 +98,81 @@ namespace ranges
                     }
                 };
                 using reference_ =
-                    indirect_view<
-                        take_while_view<
-                            iota_view<range_iterator_t<Rng>>,
-                            search_pred,
-                            is_infinite<Rng>::value>>;
-                reference_ current() const
+                    meta::if_<
+                        contiguous_,
+                        range<detail::contiguous_element_t<range_iterator_t<Rng>> *>,
+                        indirect_view<
+                            take_while_view<
+                                iota_view<range_iterator_t<Rng>>,
+                                search_pred,
+                                is_infinite<Rng>::value>>>;
+                reference_ current_(std::false_type) const
                 {
                     return reference_{{view::iota(cur_), {zero_, cur_, last_, fun_}}};
                 }
-                void next()
+                reference_ current_(std::true_type) const
+                {
+                    return as_contiguous_range(cur_, end_);
+                }
+                reference_ current() const
+                {
+                    return this->current_(contiguous_());
+                }
+                // The first match at or after it and its length, or last_ and 0.
+                std::pair<range_iterator_t<Rng>, range_difference_t<Rng>>
+                search(range_iterator_t<Rng> it, std::true_type)
+                {
+                    return fun_.search(std::move(it), last_);
+                }
+                std::pair<range_iterator_t<Rng>, range_difference_t<Rng>>
+                search(range_iterator_t<Rng> it, std::false_type)
+                {
+                    for(; it != last_; ++it)
+                    {
+                        std::pair<bool, range_difference_t<Rng>> p = fun_(it, last_);
+                        if(p.first)
+                            return {it, p.second};
+                    }
+                    return {it, 0};
+                }
+                // Find the next match at or after cur_ (after it if the last match
+                // consumed zero elements), or last_.
+                void find_end()
+                {
+                    end_ = cur_;
+                    advance_bounded(end_, (int)zero_, last_);
+                    auto p = this->search(std::move(end_), searchable_());
+                    end_ = std::move(p.first);
+                    len_ = p.second;
+                }
+                void next_(std::false_type)
                 {
-                    RANGES_ASSERT(cur_ != last_);
                     // If the last match consumed zero elements, bump the position.
                     advance_bounded(cur_, (int)zero_, last_);
                     zero_ = false;
-                    for(; cur_ != last_; ++cur_)
+                    auto p = this->search(std::move(cur_), searchable_());
+                    cur_ = std::move(p.first);
+                    if(cur_ != last_)
                     {
-                        std::pair<bool, range_difference_t<Rng>> p = fun_(cur_, last_);
-                        if(p.first)
-                        {
-                            advance(cur_, p.second);
-                            zero_ = (0 == p.second);
-                            return;
-                        }
+                        advance(cur_, p.second);
+                        zero_ = (0 == p.second);
+                    }
+                }
+                void next_(std::true_type)
+                {
+                    cur_ = end_;
+                    if(cur_ != last_)
+                    {
+                        advance(cur_, len_);
+                        zero_ = (0 == len_);
+                        this->find_end();
                     }
                 }
+                void next()
+                {
+                    RANGES_ASSERT(cur_ != last_);
+                    this->next_(contiguous_());
+                }
                 bool done() const
                 {
                     return cur_ == last_;
@@ -106,8 +186,14 @@ namespace ranges
                   : cur_(first), last_(last), fun_(fun)
                 {
                     // For skipping an initial zero-length match
-                    auto p = fun(first, last);
-                    zero_ = p.first && 0 == p.second;
+                    zero_ = false;
+                    if(first != last)
+                    {
+                        auto p = fun(first, last);
+                        zero_ = p.first && 0 == p.second;
+                    }
+                    if(contiguous_())
+                        this->find_end();
                 }
             public:
                 cursor() = default;
@@ -153,6 +239,15 @@ namespace ranges
                         RANGES_ASSERT(cur != end);
                         return *cur == val_ ? P{true, 1} : P{false, 0};
                     }
+                    // Over contiguous ranges of bytes and arithmetic types, find
+                    // scans with memchr or vector compares.
+                    std::pair<range_iterator_t<Rng>, range_difference_t<Rng>>
+                    search(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
+                    {
+                        cur = ranges::find(std::move(cur), end, val_);
+                        bool const found = cur != end;
+                        return {std::move(cur), found ? 1 : 0};
+                    }
                 };
                 template<typename Rng, typename Sub>
                 struct subrange_pred
@@ -180,6 +275,23 @@ namespace ranges
                                 return {false, 0};
                         }
                     }
+                    // Jump between occurrences of the pattern's first element, and
+                    // only try a full match there.
+                    std::pair<range_iterator_t<Rng>, range_difference_t<Rng>>
+                    search(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
+                    {
+                        if(0 == len_)
+                            return {std::move(cur), 0};
+                        auto &&first = *ranges::begin(sub_);
+                        for(;; ++cur)
+                        {
+                            cur = ranges::find(std::move(cur), end, first);
+                            if(cur == end)
+                                return {std::move(cur), 0};
+                            if((*this)(cur, end).first)
+                                return {std::move(cur), len_};
+                        }
+                    }
                 };
             public:
                 template<typename Rng, typename Fun>
@@ -19,6 +19,7 @@
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/invokable.hpp>
@@ -69,6 +70,42 @@ namespace ranges
             {
                 return {pred_};
             }
+
+            template<typename P, typename Sink>
+            struct push_fn
+            {
+                P &pred_;
+                Sink &sink_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return pred_(t) && sink_(std::forward<T>(t));
+                }
+            };
+            template<typename Self, typename Sink>
+            static range_iterator_t<Self> for_each_while_(Self &self, Sink &sink)
+            {
+                // Call the predicate through the same path as the sentinel does.
+                using P = meta::if_c<std::is_const<Self>::value ||
+                    Invokable<Pred const, range_common_reference_t<Rng>>(),
+                    semiregular_invokable_t<Pred> const, semiregular_invokable_t<Pred>>;
+                push_fn<P, Sink> push{self.pred_, sink};
+                auto it = ranges::for_each_while(self.base(), push);
+                return adaptor_cursor_t<Self>{std::move(it), range_access::begin_adaptor(self)};
+            }
+            // Push iteration; see for_each_while. The element the predicate
+            // rejects is where the view ends.
+            template<typename Sink, typename D = take_while_view>
+            range_iterator_t<D> for_each_while(Sink &sink)
+            {
+                return take_while_view::for_each_while_(*this, sink);
+            }
+            template<typename Sink, typename D = take_while_view,
+                CONCEPT_REQUIRES_(Invokable<Pred const, range_common_reference_t<Rng>>())>
+            range_iterator_t<D const> for_each_while(Sink &sink) const
+            {
+                return take_while_view::for_each_while_(*this, sink);
+            }
         public:
             take_while_view() = default;
             take_while_view(Rng && rng, Pred pred)
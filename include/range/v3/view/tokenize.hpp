@@ -19,12 +19,17 @@
 #include <utility>
 #include <type_traits>
 #include <initializer_list>
+#include <string>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
 #include <range/v3/range_interface.hpp>
+#include <range/v3/range_facade.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/dfa_pattern.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
 #include <range/v3/view/all.hpp>
 
 namespace ranges
@@ -76,11 +81,216 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            // The characters that the DFA has read from a single-pass range but that
+            // are not yet consumed. The current token is a prefix of them.
+            template<typename Rng>
+            struct dfa_input_buffer
+            {
+                std::string chars_;
+                std::size_t len_;
+                range_iterator_t<Rng> it_;
+                range_sentinel_t<Rng> last_;
+            };
+
+            struct dfa_no_buffer
+            {};
+        }
+        /// \endcond
+
+        /// Tokens of a range of \c char that match a \c dfa_pattern. Over forward
+        /// ranges each token is a subrange of the input, and a range of pointers
+        /// when the input is contiguous; nothing is allocated. Over input ranges
+        /// the characters that matching looks ahead at are buffered, and each
+        /// token refers into the buffer until the iterator is next incremented.
+        template<typename Rng>
+        struct dfa_tokenize_view
+          : range_facade<dfa_tokenize_view<Rng>>
+        {
+        private:
+            friend range_access;
+            using base_range_t = view::all_t<Rng>;
+            using buffer_t = meta::if_<ForwardIterable<Rng>,
+                detail::dfa_no_buffer, detail::dfa_input_buffer<Rng>>;
+            base_range_t rng_;
+            dfa_pattern pat_;
+            buffer_t buf_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, base_range_t>;
+                using I = range_iterator_t<base_t>;
+                using S = range_sentinel_t<base_t>;
+                detail::dfa_tables const *tables_;
+                I cur_, end_;
+                S last_;
+
+                void find(I it)
+                {
+                    while(true)
+                    {
+                        while(it != last_ && !tables_->can_start(*it))
+                            ++it;
+                        if(it == last_)
+                            break;
+                        I e = tables_->match(it, last_);
+                        if(e != it)
+                        {
+                            cur_ = std::move(it);
+                            end_ = std::move(e);
+                            return;
+                        }
+                        ++it;
+                    }
+                    cur_ = it;
+                    end_ = std::move(it);
+                }
+                using reference_ = meta::if_<is_contiguous_iterator<I>,
+                    range<detail::contiguous_element_t<I> *>, range<I>>;
+                reference_ current_(std::true_type) const
+                {
+                    return as_contiguous_range(cur_, end_);
+                }
+                reference_ current_(std::false_type) const
+                {
+                    return {cur_, end_};
+                }
+            public:
+                cursor() = default;
+                cursor(detail::dfa_tables const &tables, I first, S last)
+                  : tables_(&tables), cur_(first), end_(first), last_(std::move(last))
+                {
+                    this->find(std::move(first));
+                }
+                reference_ current() const
+                {
+                    return this->current_(is_contiguous_iterator<I>());
+                }
+                void next()
+                {
+                    this->find(end_);
+                }
+                bool done() const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+            };
+
+            struct input_cursor
+            {
+            private:
+                dfa_tokenize_view *rng_;
+            public:
+                input_cursor() = default;
+                explicit input_cursor(dfa_tokenize_view &rng)
+                  : rng_(&rng)
+                {}
+                range<char const *> current() const
+                {
+                    char const *const p = rng_->buf_.chars_.data();
+                    return {p, p + rng_->buf_.len_};
+                }
+                void next()
+                {
+                    rng_->read_token();
+                }
+                bool done() const
+                {
+                    return rng_->buf_.len_ == 0;
+                }
+            };
+
+            void read_token()
+            {
+                auto &b = buf_;
+                detail::dfa_tables const &t = *pat_.tables_;
+                b.chars_.erase(0, b.len_);
+                b.len_ = 0;
+                while(true)
+                {
+                    if(b.chars_.empty())
+                    {
+                        while(b.it_ != b.last_ && !t.can_start(*b.it_))
+                            ++b.it_;
+                        if(b.it_ == b.last_)
+                            return;
+                    }
+                    std::uint32_t s = detail::dfa_tables::start;
+                    std::size_t i = 0, len = 0;
+                    while(true)
+                    {
+                        if(i == b.chars_.size())
+                        {
+                            if(b.it_ == b.last_)
+                                break;
+                            b.chars_.push_back(*b.it_);
+                            ++b.it_;
+                        }
+                        s = t.transition(s, b.chars_[i]);
+                        if(s == detail::dfa_tables::dead)
+                            break;
+                        if(t.accepts(s))
+                            len = i + 1;
+                        ++i;
+                    }
+                    if(len != 0)
+                    {
+                        b.len_ = len;
+                        return;
+                    }
+                    b.chars_.erase(0, 1);
+                }
+            }
+
+            CONCEPT_REQUIRES(ForwardIterable<Rng>())
+            cursor<false> begin_cursor()
+            {
+                return {*pat_.tables_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng>() && Iterable<base_range_t const>())
+            cursor<true> begin_cursor() const
+            {
+                return {*pat_.tables_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(!ForwardIterable<Rng>())
+            input_cursor begin_cursor()
+            {
+                buf_.chars_.clear();
+                buf_.len_ = 0;
+                buf_.it_ = ranges::begin(rng_);
+                buf_.last_ = ranges::end(rng_);
+                this->read_token();
+                return input_cursor{*this};
+            }
+        public:
+            dfa_tokenize_view() = default;
+            dfa_tokenize_view(Rng && rng, dfa_pattern pat)
+              : rng_(view::all(std::forward<Rng>(rng))), pat_(std::move(pat)), buf_{}
+            {}
+            base_range_t & base()
+            {
+                return rng_;
+            }
+            base_range_t const & base() const
+            {
+                return rng_;
+            }
+        };
+
         namespace view
         {
             struct tokenizer_impl_fn
             {
-                template<typename Rng, typename Regex>
+                template<typename Rng, typename Regex,
+                    CONCEPT_REQUIRES_(!Same<uncvref_t<Regex>, dfa_pattern>())>
                 tokenize_view<Rng, Regex, int>
                 operator()(Rng && rng, Regex && rex, int sub = 0,
                     std::regex_constants::match_flag_type flags =
@@ -125,7 +335,17 @@ namespace ranges
                             std::move(subs), flags};
                 }
 
-                template<typename Regex>
+                template<typename Rng>
+                dfa_tokenize_view<Rng> operator()(Rng && rng, dfa_pattern pat) const
+                {
+                    CONCEPT_ASSERT(InputIterable<Rng>());
+                    static_assert(std::is_same<range_value_t<Rng>, char>::value,
+                        "view::tokenize with a dfa_pattern requires a range of char");
+                    return {std::forward<Rng>(rng), std::move(pat)};
+                }
+
+                template<typename Regex,
+                    CONCEPT_REQUIRES_(!Same<uncvref_t<Regex>, dfa_pattern>())>
                 auto operator()(Regex && rex, int sub = 0,
                     std::regex_constants::match_flag_type flags =
                         std::regex_constants::match_default) const ->
@@ -157,6 +377,14 @@ namespace ranges
                     return make_pipeable(std::bind(*this, std::placeholders::_1, bind_forward<Regex>(rex),
                         std::move(subs), std::move(flags)));
                 }
+
+                template<typename Pattern,
+                    CONCEPT_REQUIRES_(Same<Pattern, dfa_pattern>())>
+                auto operator()(Pattern pat) const ->
+                    decltype(make_pipeable(std::bind(*this, std::placeholders::_1, std::move(pat))))
+                {
+                    return make_pipeable(std::bind(*this, std::placeholders::_1, std::move(pat)));
+                }
             };
 
             // Damn C++ and its imperfect forwarding of initializer_list.
@@ -21,6 +21,8 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_block.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/utility/meta.hpp>
@@ -56,7 +58,10 @@ namespace ranges
                 adaptor(semiregular_invokable_ref_t<Fun, IsConst> fun)
                   : fun_(std::move(fun))
                 {}
-                auto current(range_iterator_t<Rng> it) const ->
+                // Either the const or the mutable base iterator, whichever the
+                // view was iterated as.
+                template<typename I>
+                auto current(I const &it) const ->
                     decltype(fun_(*it))
                 {
                     return fun_(*it);
@@ -90,6 +95,85 @@ namespace ranges
             {
                 return {fun_};
             }
+
+            // Call the function through the same path as the iterators do.
+            template<typename Self>
+            using fun_ref_t = meta::if_c<std::is_const<Self>::value ||
+                Invokable<Fun const, range_common_reference_t<Rng>>(),
+                semiregular_invokable_t<Fun> const, semiregular_invokable_t<Fun>>;
+
+            template<typename F, typename Sink>
+            struct push_fn
+            {
+                F &fun_;
+                Sink &sink_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return sink_(fun_(std::forward<T>(t)));
+                }
+            };
+            template<typename Self, typename Sink>
+            static range_iterator_t<Self> for_each_while_(Self &self, Sink &sink)
+            {
+                push_fn<fun_ref_t<Self>, Sink> push{self.fun_, sink};
+                auto it = ranges::for_each_while(self.base(), push);
+                return adaptor_cursor_t<Self>{std::move(it), range_access::begin_adaptor(self)};
+            }
+            // Push iteration; see for_each_while.
+            template<typename Sink, typename D = transform_view>
+            range_iterator_t<D> for_each_while(Sink &sink)
+            {
+                return transform_view::for_each_while_(*this, sink);
+            }
+            template<typename Sink, typename D = transform_view>
+            range_iterator_t<D const> for_each_while(Sink &sink) const
+            {
+                return transform_view::for_each_while_(*this, sink);
+            }
+
+            template<typename F, typename V, typename Sink>
+            struct block_fn
+            {
+                F &fun_;
+                Sink &sink_;
+                template<typename T>
+                void operator()(T const *p, std::ptrdiff_t n) const
+                {
+                    // A function that is only ever called as const is copied to the
+                    // stack, where the compiler can see that nothing else writes to
+                    // it and keep what it reads in registers.
+                    meta::if_<std::is_const<F>, meta::eval<std::remove_const<F>>, F &> fun = fun_;
+                    V buf[detail::block_size];
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        buf[i] = fun(p[i]);
+                    sink_(static_cast<V const *>(buf), n);
+                }
+            };
+            template<typename Self>
+            using blockable_t = meta::and_<
+                std::is_arithmetic<range_value_t<Self>>,
+                detail::is_blockable<ranges::base_range_t<Self>>,
+                Invokable<fun_ref_t<Self>, range_value_t<ranges::base_range_t<Self>> const &>>;
+            template<typename Self, typename Sink>
+            static void for_each_block_(Self &self, Sink &sink)
+            {
+                block_fn<fun_ref_t<Self>, range_value_t<Self>, Sink> block{self.fun_, sink};
+                ranges::for_each_block(self.base(), block);
+            }
+            // Block iteration; see for_each_block.
+            template<typename Sink, typename D = transform_view,
+                CONCEPT_REQUIRES_(blockable_t<D>())>
+            void for_each_block(Sink &sink)
+            {
+                transform_view::for_each_block_(*this, sink);
+            }
+            template<typename Sink, typename D = transform_view,
+                CONCEPT_REQUIRES_(blockable_t<D const>())>
+            void for_each_block(Sink &sink) const
+            {
+                transform_view::for_each_block_(*this, sink);
+            }
         public:
             transform_view() = default;
             transform_view(Rng && rng, Fun fun)
@@ -103,6 +187,16 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename Fun>
+            struct block_filters<transform_view<Rng, Fun>>
+              : block_filters<meta::eval<std::decay<Rng>>>
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct transform_fn
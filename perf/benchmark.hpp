@@ -0,0 +1,440 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// A small benchmark harness in the spirit of Google Benchmark, without the
+// dependency. Benchmarks register themselves at static initialization time
+// and are run for each requested input size. Results can be printed as a
+// table or written as JSON in Google Benchmark's format, so the usual tools
+// for comparing two runs work on them.
+
+#ifndef RANGES_PERF_BENCHMARK_HPP
+#define RANGES_PERF_BENCHMARK_HPP
+
+#include <map>
+#include <chrono>
+#include <ctime>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+namespace bench
+{
+    /// Keeps the compiler from optimizing away the computation of \c t.
+    template<typename T>
+    inline void do_not_optimize(T const &t)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(t) : "memory");
+#else
+        static volatile char sink;
+        sink = *reinterpret_cast<char const volatile *>(&t);
+#endif
+    }
+
+    /// Tells the compiler that memory may have been read or written.
+    inline void clobber_memory()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    /// Passed to each benchmark, which runs its body while keep_running()
+    /// returns true. Work done before the first call isn't timed.
+    class state
+    {
+    private:
+        std::size_t size_;
+        std::int64_t iterations_, remaining_;
+        std::chrono::steady_clock::time_point start_;
+        std::clock_t cpu_start_;
+        double real_ns_, cpu_ns_;
+        bool started_;
+        void stop()
+        {
+            auto const end = std::chrono::steady_clock::now();
+            real_ns_ = static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_).count());
+            cpu_ns_ = 1e9 * static_cast<double>(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+        }
+    public:
+        state(std::size_t size, std::int64_t iterations)
+          : size_(size), iterations_(iterations), remaining_(iterations), start_()
+          , cpu_start_(), real_ns_(0), cpu_ns_(0), started_(false)
+        {}
+        /// The input size the benchmark should use.
+        std::size_t size() const
+        {
+            return size_;
+        }
+        bool keep_running()
+        {
+            if(!started_)
+            {
+                started_ = true;
+                cpu_start_ = std::clock();
+                start_ = std::chrono::steady_clock::now();
+            }
+            if(remaining_-- > 0)
+                return true;
+            this->stop();
+            return false;
+        }
+        std::int64_t iterations() const
+        {
+            return iterations_;
+        }
+        double real_ns() const
+        {
+            return real_ns_;
+        }
+        double cpu_ns() const
+        {
+            return cpu_ns_;
+        }
+    };
+
+    using function = std::function<void(state &)>;
+
+    struct benchmark
+    {
+        std::string name;
+        function fn;
+        std::string baseline; // The name of the benchmark this one is compared against.
+    };
+
+    inline std::vector<benchmark> &registry()
+    {
+        static std::vector<benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /// Registers a benchmark. Returns an int so it can initialize a static.
+    inline int add(std::string name, function fn, std::string baseline = std::string())
+    {
+        registry().push_back(benchmark{std::move(name), std::move(fn), std::move(baseline)});
+        return 0;
+    }
+
+    /// Registers \c name/range and \c name/baseline. The report gives the ratio of
+    /// their times: the cost of the abstraction over the hand-written code.
+    inline int compare(std::string const &name, function range, function baseline)
+    {
+        bench::add(name + "/baseline", std::move(baseline));
+        return bench::add(name + "/range", std::move(range), name + "/baseline");
+    }
+
+    /// The element types benchmarks are instantiated for, and their names.
+    template<typename T>
+    struct type_name;
+
+    template<>
+    struct type_name<char>
+    {
+        static char const *get() { return "char"; }
+    };
+
+    template<>
+    struct type_name<int>
+    {
+        static char const *get() { return "int"; }
+    };
+
+    template<>
+    struct type_name<std::int64_t>
+    {
+        static char const *get() { return "int64"; }
+    };
+
+    template<>
+    struct type_name<double>
+    {
+        static char const *get() { return "double"; }
+    };
+
+    /// \c n pseudo-random values in [0, 1000), the same on every run.
+    template<typename T>
+    std::vector<T> random_data(std::size_t n, unsigned seed = 42)
+    {
+        std::mt19937 gen{seed};
+        std::uniform_int_distribution<int> dist{0, 999};
+        std::vector<T> v(n);
+        for(T &t : v)
+            t = static_cast<T>(dist(gen));
+        return v;
+    }
+
+    struct result
+    {
+        std::string name;
+        std::size_t size;
+        std::int64_t iterations;
+        double real_ns, cpu_ns; // Per iteration.
+        std::string baseline;
+    };
+
+    struct options
+    {
+        std::vector<std::size_t> sizes{1u << 10, 1u << 16, 1u << 20};
+        std::string filter;
+        std::string format = "console";
+        std::string out;
+        std::string compare;
+        double min_time = 0.1;
+    };
+
+    inline std::vector<std::size_t> parse_sizes(std::string const &s)
+    {
+        std::vector<std::size_t> sizes;
+        std::istringstream sin{s};
+        std::string tok;
+        while(std::getline(sin, tok, ','))
+            if(!tok.empty())
+                sizes.push_back(static_cast<std::size_t>(std::strtoull(tok.c_str(), nullptr, 0)));
+        return sizes;
+    }
+
+    inline std::string full_name(std::string const &name, std::size_t size)
+    {
+        // Insert the size before the trailing /range or /baseline, if any.
+        auto const slash = name.rfind('/');
+        std::string const suffix = name.substr(slash == std::string::npos ? name.size() : slash);
+        bool const paired = suffix == "/range" || suffix == "/baseline";
+        std::string const stem = paired ? name.substr(0, slash) : name;
+        return stem + "/" + std::to_string(size) + (paired ? suffix : "");
+    }
+
+    // Runs one benchmark, growing the iteration count until the run takes at
+    // least min_time seconds.
+    inline result run(benchmark const &b, std::size_t size, double min_time)
+    {
+        std::int64_t iterations = 1;
+        while(true)
+        {
+            state st{size, iterations};
+            b.fn(st);
+            double const secs = st.real_ns() / 1e9;
+            if(secs >= min_time || iterations >= (std::int64_t(1) << 40))
+                return {full_name(b.name, size), size, iterations,
+                    st.real_ns() / static_cast<double>(iterations),
+                    st.cpu_ns() / static_cast<double>(iterations),
+                    b.baseline.empty() ? std::string() : full_name(b.baseline, size)};
+            double const scale = secs <= min_time / 100 ? 100 : 1.4 * min_time / secs;
+            iterations = std::max(iterations + 1,
+                static_cast<std::int64_t>(static_cast<double>(iterations) * scale));
+        }
+    }
+
+    inline std::string json_escape(std::string const &s)
+    {
+        std::string r;
+        for(char c : s)
+        {
+            if(c == '"' || c == '\\')
+                r += '\\';
+            r += c;
+        }
+        return r;
+    }
+
+    inline void write_json(std::ostream &out, std::vector<result> const &results)
+    {
+        std::map<std::string, double> times;
+        for(auto const &r : results)
+            times[r.name] = r.real_ns;
+        std::time_t const now = std::time(nullptr);
+        char date[64];
+        std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"executable\": \"range_v3_benchmarks\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+            << "    \"library_build_type\": \"release\"\n"
+#else
+            << "    \"library_build_type\": \"debug\"\n"
+#endif
+            << "  },\n  \"benchmarks\": [\n";
+        out << std::setprecision(10);
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+            auto const &r = results[i];
+            // One benchmark per line, so the file diffs well.
+            out << "    {\"name\": \"" << json_escape(r.name) << "\", \"run_type\": \"iteration\""
+                << ", \"iterations\": " << r.iterations
+                << ", \"real_time\": " << r.real_ns << ", \"cpu_time\": " << r.cpu_ns
+                << ", \"time_unit\": \"ns\""
+                << ", \"items_per_second\": " << (r.real_ns > 0 ? 1e9 * r.size / r.real_ns : 0);
+            auto const base = times.find(r.baseline);
+            if(base != times.end() && base->second > 0)
+                out << ", \"abstraction_penalty\": " << r.real_ns / base->second;
+            out << "}" << (i + 1 == results.size() ? "\n" : ",\n");
+        }
+        out << "  ]\n}\n";
+    }
+
+    // Reads back the name and real_time of each benchmark in a file written by
+    // write_json.
+    inline std::map<std::string, double> read_json(std::string const &path)
+    {
+        std::map<std::string, double> times;
+        std::ifstream in{path};
+        std::string line;
+        while(std::getline(in, line))
+        {
+            auto const n = line.find("\"name\": \"");
+            auto const t = line.find("\"real_time\": ");
+            if(n == std::string::npos || t == std::string::npos)
+                continue;
+            auto const b = n + 9, e = line.find('"', b);
+            times[line.substr(b, e - b)] = std::strtod(line.c_str() + t + 13, nullptr);
+        }
+        return times;
+    }
+
+    inline void write_table(std::ostream &out, std::vector<result> const &results,
+        std::map<std::string, double> const &old)
+    {
+        std::map<std::string, double> times;
+        for(auto const &r : results)
+            times[r.name] = r.real_ns;
+        out << std::left << std::setw(52) << "benchmark" << std::right << std::setw(14)
+            << "ns/iter" << std::setw(12) << "ns/elem" << std::setw(10) << "penalty";
+        if(!old.empty())
+            out << std::setw(10) << "change";
+        out << '\n' << std::fixed;
+        for(auto const &r : results)
+        {
+            out << std::left << std::setw(52) << r.name << std::right << std::setprecision(1)
+                << std::setw(14) << r.real_ns << std::setprecision(3) << std::setw(12)
+                << r.real_ns / static_cast<double>(std::max<std::size_t>(r.size, 1));
+            auto const base = times.find(r.baseline);
+            if(base != times.end() && base->second > 0)
+                out << std::setw(9) << std::setprecision(2) << r.real_ns / base->second << 'x';
+            else
+                out << std::setw(10) << "";
+            if(!old.empty())
+            {
+                auto const o = old.find(r.name);
+                if(o != old.end() && o->second > 0)
+                    out << std::setw(9) << std::setprecision(1) << std::showpos
+                        << 100 * (r.real_ns - o->second) / o->second << std::noshowpos << '%';
+            }
+            out << '\n';
+        }
+    }
+
+    inline int usage(char const *argv0)
+    {
+        std::cerr << "Usage: " << argv0 << " [options]\n"
+            << "  --filter=<text>      only run benchmarks whose name contains <text>\n"
+            << "  --sizes=<n,n,...>    input sizes (default 1024,65536,1048576)\n"
+            << "  --min-time=<secs>    minimum time per measurement (default 0.1)\n"
+            << "  --format=console|json\n"
+            << "  --out=<file>         write the report to <file> instead of stdout\n"
+            << "  --compare=<file>     show the change from a previous JSON report\n"
+            << "  --list               list the benchmarks and exit\n";
+        return 1;
+    }
+
+    inline int main(int argc, char *argv[])
+    {
+        options opts;
+        bool list = false;
+        for(int i = 1; i < argc; ++i)
+        {
+            std::string const arg = argv[i];
+            auto value = [&](char const *opt) -> char const *
+            {
+                std::size_t const len = std::strlen(opt);
+                return arg.compare(0, len, opt) == 0 ? arg.c_str() + len : nullptr;
+            };
+            if(char const *v = value("--filter="))
+                opts.filter = v;
+            else if(char const *v = value("--sizes="))
+                opts.sizes = bench::parse_sizes(v);
+            else if(char const *v = value("--min-time="))
+                opts.min_time = std::strtod(v, nullptr);
+            else if(char const *v = value("--format="))
+                opts.format = v;
+            else if(char const *v = value("--out="))
+                opts.out = v;
+            else if(char const *v = value("--compare="))
+                opts.compare = v;
+            else if(arg == "--list")
+                list = true;
+            else
+                return bench::usage(argv[0]);
+        }
+        if(opts.sizes.empty() || (opts.format != "console" && opts.format != "json"))
+            return bench::usage(argv[0]);
+
+        std::vector<result> results;
+        for(auto const &b : registry())
+        {
+            if(b.name.find(opts.filter) == std::string::npos)
+                continue;
+            if(list)
+            {
+                std::cout << b.name << '\n';
+                continue;
+            }
+            for(std::size_t size : opts.sizes)
+            {
+                results.push_back(bench::run(b, size, opts.min_time));
+                if(opts.format == "json" || !opts.out.empty())
+                    std::cerr << results.back().name << '\n';
+            }
+        }
+        if(list)
+            return 0;
+
+        std::ofstream file;
+        if(!opts.out.empty())
+        {
+            file.open(opts.out);
+            if(!file)
+            {
+                std::cerr << "Cannot open " << opts.out << '\n';
+                return 1;
+            }
+        }
+        std::ostream &out = opts.out.empty() ? std::cout : file;
+        if(opts.format == "json")
+            bench::write_json(out, results);
+        else
+            bench::write_table(out, results, opts.compare.empty() ?
+                std::map<std::string, double>{} : bench::read_json(opts.compare));
+        return 0;
+    }
+}
+
+#define RANGES_BENCH_CAT_(X, Y) X ## Y
+#define RANGES_BENCH_CAT(X, Y) RANGES_BENCH_CAT_(X, Y)
+
+/// Registers benchmarks at namespace scope: RANGES_BENCH(bench::add(...));
+#define RANGES_BENCH(...) \
+    static int const RANGES_BENCH_CAT(ranges_bench_, __LINE__) = (__VA_ARGS__)
+
+#endif
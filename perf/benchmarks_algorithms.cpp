@@ -0,0 +1,422 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Each algorithm against its std:: counterpart on the same input.
+
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm.hpp>
+#include <range/v3/algorithm/fill_n.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/is_sorted_until.hpp>
+#include <range/v3/algorithm/minmax_element.hpp>
+#include <range/v3/numeric.hpp>
+#include <range/v3/view/take.hpp>
+#include "./benchmark.hpp"
+
+namespace
+{
+    using bench::state;
+
+    template<typename T>
+    std::vector<T> data(std::size_t n)
+    {
+        return bench::random_data<T>(n);
+    }
+
+    template<typename T>
+    std::vector<T> sorted(std::size_t n)
+    {
+        auto v = bench::random_data<T>(n);
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    template<typename T>
+    std::string name_of(char const *name)
+    {
+        return std::string("algorithm/") + name + "/" + bench::type_name<T>::get();
+    }
+
+    // Algorithms that only read their input. Both functions return a value
+    // derived from their result.
+    template<typename T, typename Range, typename Std>
+    void reads(char const *name, Range range, Std std_,
+        std::vector<T> (*input)(std::size_t) = &data<T>)
+    {
+        bench::compare(name_of<T>(name),
+            [=](state &st)
+            {
+                auto const in = input(st.size());
+                while(st.keep_running())
+                    bench::do_not_optimize(range(in));
+            },
+            [=](state &st)
+            {
+                auto const in = input(st.size());
+                while(st.keep_running())
+                    bench::do_not_optimize(std_(in));
+            });
+    }
+
+    // Algorithms that write. Each iteration restores the input into a scratch
+    // vector (on both sides) and hands that over.
+    template<typename T, typename Range, typename Std>
+    void writes(char const *name, Range range, Std std_,
+        std::vector<T> (*input)(std::size_t) = &data<T>)
+    {
+        auto const run = [=](state &st, bool use_range)
+        {
+            auto const in = input(st.size());
+            std::vector<T> work(in.size()), out(in.size() * 2);
+            while(st.keep_running())
+            {
+                std::copy(in.begin(), in.end(), work.begin());
+                if(use_range)
+                    range(work, out);
+                else
+                    std_(work, out);
+                bench::do_not_optimize(work.data());
+                bench::do_not_optimize(out.data());
+                bench::clobber_memory();
+            }
+        };
+        bench::compare(name_of<T>(name),
+            [=](state &st) { run(st, true); },
+            [=](state &st) { run(st, false); });
+    }
+
+    template<typename T>
+    int register_algorithms()
+    {
+        using V = std::vector<T>;
+        auto const is_big = [](T t) { return t >= T(500); };
+        auto const never = [](T t) { return t > T(1000); };
+        auto const distance = [](V const &v, typename V::const_iterator i)
+        {
+            return i - v.begin();
+        };
+
+        // Non-modifying sequence operations
+        reads<T>("all_of",
+            [=](V const &v) { return ranges::all_of(v, [](T t) { return t >= T(0); }); },
+            [=](V const &v) { return std::all_of(v.begin(), v.end(), [](T t) { return t >= T(0); }); });
+        reads<T>("any_of",
+            [=](V const &v) { return ranges::any_of(v, never); },
+            [=](V const &v) { return std::any_of(v.begin(), v.end(), never); });
+        reads<T>("none_of",
+            [=](V const &v) { return ranges::none_of(v, never); },
+            [=](V const &v) { return std::none_of(v.begin(), v.end(), never); });
+        reads<T>("for_each",
+            [=](V const &v) { T s = 0; ranges::for_each(v, [&](T t) { s += t; }); return s; },
+            [=](V const &v) { T s = 0; std::for_each(v.begin(), v.end(), [&](T t) { s += t; }); return s; });
+        reads<T>("count",
+            [=](V const &v) { return ranges::count(v, T(7)); },
+            [=](V const &v) { return std::count(v.begin(), v.end(), T(7)); });
+        reads<T>("count_if",
+            [=](V const &v) { return ranges::count_if(v, is_big); },
+            [=](V const &v) { return std::count_if(v.begin(), v.end(), is_big); });
+        reads<T>("find",
+            [=](V const &v) { return distance(v, ranges::find(v, T(1000))); },
+            [=](V const &v) { return distance(v, std::find(v.begin(), v.end(), T(1000))); });
+        reads<T>("find_if",
+            [=](V const &v) { return distance(v, ranges::find_if(v, never)); },
+            [=](V const &v) { return distance(v, std::find_if(v.begin(), v.end(), never)); });
+        reads<T>("find_if_not",
+            [=](V const &v) { return distance(v, ranges::find_if_not(v, [](T t) { return t < T(1000); })); },
+            [=](V const &v) { return distance(v, std::find_if(v.begin(), v.end(), never)); });
+        reads<T>("adjacent_find",
+            [=](V const &v) { return distance(v, ranges::adjacent_find(v, [](T a, T b) { return a + b > T(1998); })); },
+            [=](V const &v) { return distance(v, std::adjacent_find(v.begin(), v.end(), [](T a, T b) { return a + b > T(1998); })); });
+        reads<T>("mismatch",
+            [=](V const &v) { return distance(v, ranges::mismatch(v, v).first); },
+            [=](V const &v) { return distance(v, std::mismatch(v.begin(), v.end(), v.begin()).first); });
+        reads<T>("equal",
+            [=](V const &v) { return ranges::equal(v, v); },
+            [=](V const &v) { return std::equal(v.begin(), v.end(), v.begin()); });
+        reads<T>("lexicographical_compare",
+            [=](V const &v) { return ranges::lexicographical_compare(v, v); },
+            [=](V const &v) { return std::lexicographical_compare(v.begin(), v.end(), v.begin(), v.end()); });
+        reads<T>("search",
+            [=](V const &v) { T const n[] = {T(1), T(2), T(3)}; return distance(v, ranges::search(v, n)); },
+            [=](V const &v) { T const n[] = {T(1), T(2), T(3)}; return distance(v, std::search(v.begin(), v.end(), n, n + 3)); });
+        reads<T>("search_n",
+            [=](V const &v) { return distance(v, ranges::search_n(v, 3, T(7))); },
+            [=](V const &v) { return distance(v, std::search_n(v.begin(), v.end(), 3, T(7))); });
+        reads<T>("find_end",
+            [=](V const &v) { T const n[] = {T(1), T(2)}; return distance(v, ranges::find_end(v, n)); },
+            [=](V const &v) { T const n[] = {T(1), T(2)}; return distance(v, std::find_end(v.begin(), v.end(), n, n + 2)); });
+        reads<T>("find_first_of",
+            [=](V const &v) { T const n[] = {T(1000), T(1001), T(1002)}; return distance(v, ranges::find_first_of(v, n)); },
+            [=](V const &v) { T const n[] = {T(1000), T(1001), T(1002)}; return distance(v, std::find_first_of(v.begin(), v.end(), n, n + 3)); });
+
+        // Modifying sequence operations
+        writes<T>("copy",
+            [=](V &in, V &out) { ranges::copy(in, out.begin()); },
+            [=](V &in, V &out) { std::copy(in.begin(), in.end(), out.begin()); });
+        writes<T>("copy_if",
+            [=](V &in, V &out) { ranges::copy_if(in, out.begin(), is_big); },
+            [=](V &in, V &out) { std::copy_if(in.begin(), in.end(), out.begin(), is_big); });
+        writes<T>("copy_n",
+            [=](V &in, V &out) { ranges::copy_n(in.begin(), (std::ptrdiff_t)in.size(), out.begin()); },
+            [=](V &in, V &out) { std::copy_n(in.begin(), in.size(), out.begin()); });
+        writes<T>("copy_backward",
+            [=](V &in, V &out) { ranges::copy_backward(in, out.begin() + in.size()); },
+            [=](V &in, V &out) { std::copy_backward(in.begin(), in.end(), out.begin() + in.size()); });
+        writes<T>("move",
+            [=](V &in, V &out) { ranges::move(in, out.begin()); },
+            [=](V &in, V &out) { std::move(in.begin(), in.end(), out.begin()); });
+        writes<T>("move_backward",
+            [=](V &in, V &out) { ranges::move_backward(in, out.begin() + in.size()); },
+            [=](V &in, V &out) { std::move_backward(in.begin(), in.end(), out.begin() + in.size()); });
+        writes<T>("fill",
+            [=](V &in, V &) { ranges::fill(in, T(3)); },
+            [=](V &in, V &) { std::fill(in.begin(), in.end(), T(3)); });
+        writes<T>("fill_n",
+            [=](V &in, V &) { ranges::fill_n(in.begin(), (std::ptrdiff_t)in.size(), T(3)); },
+            [=](V &in, V &) { std::fill_n(in.begin(), in.size(), T(3)); });
+        writes<T>("generate",
+            [=](V &in, V &) { T i = 0; ranges::generate(in, [&] { return i++; }); },
+            [=](V &in, V &) { T i = 0; std::generate(in.begin(), in.end(), [&] { return i++; }); });
+        writes<T>("generate_n",
+            [=](V &in, V &) { T i = 0; ranges::generate_n(in.begin(), (std::ptrdiff_t)in.size(), [&] { return i++; }); },
+            [=](V &in, V &) { T i = 0; std::generate_n(in.begin(), in.size(), [&] { return i++; }); });
+        writes<T>("transform",
+            [=](V &in, V &out) { ranges::transform(in, out.begin(), [](T t) { return t * 2; }); },
+            [=](V &in, V &out) { std::transform(in.begin(), in.end(), out.begin(), [](T t) { return t * 2; }); });
+        writes<T>("transform2",
+            [=](V &in, V &out) { ranges::transform(in, in, out.begin(), std::plus<T>{}); },
+            [=](V &in, V &out) { std::transform(in.begin(), in.end(), in.begin(), out.begin(), std::plus<T>{}); });
+        writes<T>("replace",
+            [=](V &in, V &) { ranges::replace(in, T(7), T(8)); },
+            [=](V &in, V &) { std::replace(in.begin(), in.end(), T(7), T(8)); });
+        writes<T>("replace_if",
+            [=](V &in, V &) { ranges::replace_if(in, is_big, T(0)); },
+            [=](V &in, V &) { std::replace_if(in.begin(), in.end(), is_big, T(0)); });
+        writes<T>("replace_copy",
+            [=](V &in, V &out) { ranges::replace_copy(in, out.begin(), T(7), T(8)); },
+            [=](V &in, V &out) { std::replace_copy(in.begin(), in.end(), out.begin(), T(7), T(8)); });
+        writes<T>("replace_copy_if",
+            [=](V &in, V &out) { ranges::replace_copy_if(in, out.begin(), is_big, T(0)); },
+            [=](V &in, V &out) { std::replace_copy_if(in.begin(), in.end(), out.begin(), is_big, T(0)); });
+        writes<T>("remove",
+            [=](V &in, V &) { ranges::remove(in, T(7)); },
+            [=](V &in, V &) { std::remove(in.begin(), in.end(), T(7)); });
+        writes<T>("remove_if",
+            [=](V &in, V &) { ranges::remove_if(in, is_big); },
+            [=](V &in, V &) { std::remove_if(in.begin(), in.end(), is_big); });
+        writes<T>("remove_copy",
+            [=](V &in, V &out) { ranges::remove_copy(in, out.begin(), T(7)); },
+            [=](V &in, V &out) { std::remove_copy(in.begin(), in.end(), out.begin(), T(7)); });
+        writes<T>("remove_copy_if",
+            [=](V &in, V &out) { ranges::remove_copy_if(in, out.begin(), is_big); },
+            [=](V &in, V &out) { std::remove_copy_if(in.begin(), in.end(), out.begin(), is_big); });
+        writes<T>("unique",
+            [=](V &in, V &) { ranges::unique(in); },
+            [=](V &in, V &) { std::unique(in.begin(), in.end()); }, &sorted<T>);
+        writes<T>("unique_copy",
+            [=](V &in, V &out) { ranges::unique_copy(in, out.begin()); },
+            [=](V &in, V &out) { std::unique_copy(in.begin(), in.end(), out.begin()); }, &sorted<T>);
+        writes<T>("reverse",
+            [=](V &in, V &) { ranges::reverse(in); },
+            [=](V &in, V &) { std::reverse(in.begin(), in.end()); });
+        writes<T>("reverse_copy",
+            [=](V &in, V &out) { ranges::reverse_copy(in, out.begin()); },
+            [=](V &in, V &out) { std::reverse_copy(in.begin(), in.end(), out.begin()); });
+        writes<T>("rotate",
+            [=](V &in, V &) { ranges::rotate(in, in.begin() + in.size() / 3); },
+            [=](V &in, V &) { std::rotate(in.begin(), in.begin() + in.size() / 3, in.end()); });
+        writes<T>("rotate_copy",
+            [=](V &in, V &out) { ranges::rotate_copy(in, in.begin() + in.size() / 3, out.begin()); },
+            [=](V &in, V &out) { std::rotate_copy(in.begin(), in.begin() + in.size() / 3, in.end(), out.begin()); });
+        writes<T>("shuffle",
+            [=](V &in, V &) { std::mt19937 g{1}; ranges::shuffle(in, g); },
+            [=](V &in, V &) { std::mt19937 g{1}; std::shuffle(in.begin(), in.end(), g); });
+        writes<T>("swap_ranges",
+            [=](V &in, V &out) { ranges::swap_ranges(in, out.begin()); },
+            [=](V &in, V &out) { std::swap_ranges(in.begin(), in.end(), out.begin()); });
+
+        // Partitioning operations
+        reads<T>("is_partitioned",
+            [=](V const &v) { return ranges::is_partitioned(v, never); },
+            [=](V const &v) { return std::is_partitioned(v.begin(), v.end(), never); });
+        writes<T>("partition",
+            [=](V &in, V &) { ranges::partition(in, is_big); },
+            [=](V &in, V &) { std::partition(in.begin(), in.end(), is_big); });
+        writes<T>("stable_partition",
+            [=](V &in, V &) { ranges::stable_partition(in, is_big); },
+            [=](V &in, V &) { std::stable_partition(in.begin(), in.end(), is_big); });
+        writes<T>("partition_copy",
+            [=](V &in, V &out) { ranges::partition_copy(in, out.begin(), out.begin() + in.size(), is_big); },
+            [=](V &in, V &out) { std::partition_copy(in.begin(), in.end(), out.begin(), out.begin() + in.size(), is_big); });
+        reads<T>("partition_point",
+            [=](V const &v) { return distance(v, ranges::partition_point(v, [](T t) { return t < T(500); })); },
+            [=](V const &v) { return distance(v, std::partition_point(v.begin(), v.end(), [](T t) { return t < T(500); })); },
+            &sorted<T>);
+
+        // Sorting operations
+        writes<T>("sort",
+            [=](V &in, V &) { ranges::sort(in); },
+            [=](V &in, V &) { std::sort(in.begin(), in.end()); });
+        writes<T>("stable_sort",
+            [=](V &in, V &) { ranges::stable_sort(in); },
+            [=](V &in, V &) { std::stable_sort(in.begin(), in.end()); });
+        writes<T>("radix_sort",
+            [=](V &in, V &) { ranges::radix_sort(in); },
+            [=](V &in, V &) { std::stable_sort(in.begin(), in.end()); });
+        writes<T>("partial_sort",
+            [=](V &in, V &) { ranges::partial_sort(in, in.begin() + in.size() / 10); },
+            [=](V &in, V &) { std::partial_sort(in.begin(), in.begin() + in.size() / 10, in.end()); });
+        writes<T>("partial_sort_copy",
+            [=](V &in, V &out) { auto first = out | ranges::view::take(in.size() / 10); ranges::partial_sort_copy(in, first); },
+            [=](V &in, V &out) { std::partial_sort_copy(in.begin(), in.end(), out.begin(), out.begin() + in.size() / 10); });
+        writes<T>("nth_element",
+            [=](V &in, V &) { ranges::nth_element(in, in.begin() + in.size() / 2); },
+            [=](V &in, V &) { std::nth_element(in.begin(), in.begin() + in.size() / 2, in.end()); });
+        reads<T>("is_sorted",
+            [=](V const &v) { return ranges::is_sorted(v); },
+            [=](V const &v) { return std::is_sorted(v.begin(), v.end()); }, &sorted<T>);
+        reads<T>("is_sorted_until",
+            [=](V const &v) { return distance(v, ranges::is_sorted_until(v)); },
+            [=](V const &v) { return distance(v, std::is_sorted_until(v.begin(), v.end())); }, &sorted<T>);
+
+        // Binary search operations, one lookup per 16 elements
+        auto const lookups = [](V const &v, std::function<std::ptrdiff_t(T)> f)
+        {
+            std::ptrdiff_t s = 0;
+            for(std::size_t i = 0; i < v.size(); i += 16)
+                s += f(v[(i * 7919) % v.size()]);
+            return s;
+        };
+        reads<T>("lower_bound",
+            [=](V const &v) { return lookups(v, [&](T t) { return distance(v, ranges::lower_bound(v, t)); }); },
+            [=](V const &v) { return lookups(v, [&](T t) { return distance(v, std::lower_bound(v.begin(), v.end(), t)); }); },
+            &sorted<T>);
+        reads<T>("upper_bound",
+            [=](V const &v) { return lookups(v, [&](T t) { return distance(v, ranges::upper_bound(v, t)); }); },
+            [=](V const &v) { return lookups(v, [&](T t) { return distance(v, std::upper_bound(v.begin(), v.end(), t)); }); },
+            &sorted<T>);
+        reads<T>("equal_range",
+            [=](V const &v) { return lookups(v, [&](T t) { return distance(v, ranges::equal_range(v, t).end()); }); },
+            [=](V const &v) { return lookups(v, [&](T t) { return distance(v, std::equal_range(v.begin(), v.end(), t).second); }); },
+            &sorted<T>);
+        reads<T>("binary_search",
+            [=](V const &v) { return lookups(v, [&](T t) { return std::ptrdiff_t(ranges::binary_search(v, t)); }); },
+            [=](V const &v) { return lookups(v, [&](T t) { return std::ptrdiff_t(std::binary_search(v.begin(), v.end(), t)); }); },
+            &sorted<T>);
+
+        // Operations on sorted ranges; the two inputs are the halves of the input.
+        writes<T>("merge",
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; ranges::merge(in.begin(), m, m, in.end(), out.begin()); },
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; std::merge(in.begin(), m, m, in.end(), out.begin()); },
+            &sorted<T>);
+        writes<T>("inplace_merge",
+            [=](V &in, V &) { ranges::sort(in.begin() + in.size() / 3, in.end()); ranges::inplace_merge(in, in.begin() + in.size() / 3); },
+            [=](V &in, V &) { std::sort(in.begin() + in.size() / 3, in.end()); std::inplace_merge(in.begin(), in.begin() + in.size() / 3, in.end()); },
+            &sorted<T>);
+        reads<T>("includes",
+            [=](V const &v) { auto m = v.begin() + v.size() / 2; return ranges::includes(v.begin(), v.end(), m, v.end()); },
+            [=](V const &v) { auto m = v.begin() + v.size() / 2; return std::includes(v.begin(), v.end(), m, v.end()); },
+            &sorted<T>);
+        writes<T>("set_union",
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; ranges::set_union(in.begin(), m, m, in.end(), out.begin()); },
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; std::set_union(in.begin(), m, m, in.end(), out.begin()); });
+        writes<T>("set_intersection",
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; ranges::set_intersection(in.begin(), m, m, in.end(), out.begin()); },
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; std::set_intersection(in.begin(), m, m, in.end(), out.begin()); });
+        writes<T>("set_difference",
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; ranges::set_difference(in.begin(), m, m, in.end(), out.begin()); },
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; std::set_difference(in.begin(), m, m, in.end(), out.begin()); });
+        writes<T>("set_symmetric_difference",
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; ranges::set_symmetric_difference(in.begin(), m, m, in.end(), out.begin()); },
+            [=](V &in, V &out) { auto m = in.begin() + in.size() / 2; std::set_symmetric_difference(in.begin(), m, m, in.end(), out.begin()); });
+
+        // Heap operations
+        writes<T>("make_heap",
+            [=](V &in, V &) { ranges::make_heap(in); },
+            [=](V &in, V &) { std::make_heap(in.begin(), in.end()); });
+        writes<T>("push_heap",
+            [=](V &in, V &) { for(auto i = in.begin(); i != in.end(); ++i) ranges::push_heap(in.begin(), i + 1); },
+            [=](V &in, V &) { for(auto i = in.begin(); i != in.end(); ++i) std::push_heap(in.begin(), i + 1); });
+        writes<T>("pop_heap",
+            [=](V &in, V &) { std::make_heap(in.begin(), in.end()); for(auto i = in.end(); i != in.begin(); --i) ranges::pop_heap(in.begin(), i); },
+            [=](V &in, V &) { std::make_heap(in.begin(), in.end()); for(auto i = in.end(); i != in.begin(); --i) std::pop_heap(in.begin(), i); });
+        writes<T>("sort_heap",
+            [=](V &in, V &) { std::make_heap(in.begin(), in.end()); ranges::sort_heap(in); },
+            [=](V &in, V &) { std::make_heap(in.begin(), in.end()); std::sort_heap(in.begin(), in.end()); });
+        reads<T>("is_heap",
+            [=](V const &v) { return ranges::is_heap(v, std::greater<T>{}); },
+            [=](V const &v) { return std::is_heap(v.begin(), v.end(), std::greater<T>{}); }, &sorted<T>);
+        reads<T>("is_heap_until",
+            [=](V const &v) { return distance(v, ranges::is_heap_until(v, std::greater<T>{})); },
+            [=](V const &v) { return distance(v, std::is_heap_until(v.begin(), v.end(), std::greater<T>{})); }, &sorted<T>);
+
+        // Minimum/maximum operations
+        reads<T>("min_element",
+            [=](V const &v) { return distance(v, ranges::min_element(v)); },
+            [=](V const &v) { return distance(v, std::min_element(v.begin(), v.end())); });
+        reads<T>("max_element",
+            [=](V const &v) { return distance(v, ranges::max_element(v)); },
+            [=](V const &v) { return distance(v, std::max_element(v.begin(), v.end())); });
+        reads<T>("minmax_element",
+            [=](V const &v) { return distance(v, ranges::minmax_element(v).first); },
+            [=](V const &v) { return distance(v, std::minmax_element(v.begin(), v.end()).first); });
+
+        // Permutations; is_permutation is quadratic, so it sees a 256-element prefix.
+        reads<T>("is_permutation",
+            [=](V const &v) { auto e = v.begin() + std::min<std::size_t>(v.size(), 256); return ranges::is_permutation(v.begin(), e, v.rbegin(), v.rbegin() + (e - v.begin())); },
+            [=](V const &v) { auto e = v.begin() + std::min<std::size_t>(v.size(), 256); return std::is_permutation(v.begin(), e, v.rbegin()); });
+        writes<T>("next_permutation",
+            [=](V &in, V &) { for(int i = 0; i < 1000; ++i) ranges::next_permutation(in); },
+            [=](V &in, V &) { for(int i = 0; i < 1000; ++i) std::next_permutation(in.begin(), in.end()); });
+        writes<T>("prev_permutation",
+            [=](V &in, V &) { for(int i = 0; i < 1000; ++i) ranges::prev_permutation(in); },
+            [=](V &in, V &) { for(int i = 0; i < 1000; ++i) std::prev_permutation(in.begin(), in.end()); });
+
+        // Numeric operations
+        reads<T>("accumulate",
+            [=](V const &v) { return ranges::accumulate(v, T(0)); },
+            [=](V const &v) { return std::accumulate(v.begin(), v.end(), T(0)); });
+        reads<T>("inner_product",
+            [=](V const &v) { return ranges::inner_product(v, v, T(0)); },
+            [=](V const &v) { return std::inner_product(v.begin(), v.end(), v.begin(), T(0)); });
+        reads<T>("accumulate_unseq",
+            [=](V const &v) { return ranges::accumulate(ranges::unseq, v, T(0)); },
+            [=](V const &v) { return std::accumulate(v.begin(), v.end(), T(0)); });
+        reads<T>("inner_product_unseq",
+            [=](V const &v) { return ranges::inner_product(ranges::unseq, v, v, T(0)); },
+            [=](V const &v) { return std::inner_product(v.begin(), v.end(), v.begin(), T(0)); });
+        writes<T>("partial_sum",
+            [=](V &in, V &out) { ranges::partial_sum(in, out.begin()); },
+            [=](V &in, V &out) { std::partial_sum(in.begin(), in.end(), out.begin()); });
+        writes<T>("inclusive_scan",
+            [=](V &in, V &out) { ranges::inclusive_scan(in, out.begin()); },
+            [=](V &in, V &out) { std::partial_sum(in.begin(), in.end(), out.begin()); });
+        writes<T>("adjacent_difference",
+            [=](V &in, V &out) { ranges::adjacent_difference(in, out.begin()); },
+            [=](V &in, V &out) { std::adjacent_difference(in.begin(), in.end(), out.begin()); });
+        writes<T>("iota",
+            [=](V &in, V &) { ranges::iota(in, 0); },
+            [=](V &in, V &) { std::iota(in.begin(), in.end(), 0); });
+        return 0;
+    }
+
+    RANGES_BENCH(register_algorithms<int>());
+    RANGES_BENCH(register_algorithms<std::int64_t>());
+    RANGES_BENCH(register_algorithms<double>());
+}
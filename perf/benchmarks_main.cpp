@@ -0,0 +1,26 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// The views and algorithms benchmarks, each against the hand-written or std::
+// equivalent. Run with --help for the options; for example,
+//
+//   range_v3_benchmarks --format=json --out=before.json
+//   range_v3_benchmarks --compare=before.json
+//
+// records a run and then shows how each benchmark has changed since.
+
+#include "./benchmark.hpp"
+
+int main(int argc, char *argv[])
+{
+    return bench::main(argc, argv);
+}
@@ -0,0 +1,695 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Each view adaptor against the loop one would write by hand to compute the
+// same thing. Both sides reduce their output to a single value, so the
+// reported penalty is the cost of the abstraction.
+
+#include <regex>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/view.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/any_range.hpp>
+#include "./benchmark.hpp"
+
+namespace
+{
+    using bench::state;
+
+    template<typename T, typename Rng>
+    T sum(Rng && rng)
+    {
+        T s = 0;
+        for(auto i = ranges::begin(rng), e = ranges::end(rng); i != e; ++i)
+            s += static_cast<T>(*i);
+        return s;
+    }
+
+    template<typename Rng>
+    std::size_t length(Rng && rng)
+    {
+        std::size_t n = 0;
+        for(auto i = ranges::begin(rng), e = ranges::end(rng); i != e; ++i)
+            ++n;
+        return n;
+    }
+
+    // Registers view/<name>/<type>/<size>/{range,baseline}. Both functions are
+    // called with the same input each iteration.
+    template<typename T, typename Input, typename Range, typename Baseline>
+    void compare(char const *name, Input input, Range range, Baseline baseline)
+    {
+        std::string const full = std::string("view/") + name + "/" + bench::type_name<T>::get();
+        bench::compare(full,
+            [=](state &st)
+            {
+                auto in = input(st.size());
+                while(st.keep_running())
+                    bench::do_not_optimize(range(in));
+            },
+            [=](state &st)
+            {
+                auto in = input(st.size());
+                while(st.keep_running())
+                    bench::do_not_optimize(baseline(in));
+            });
+    }
+
+    template<typename T>
+    std::vector<T> data(std::size_t n)
+    {
+        return bench::random_data<T>(n);
+    }
+
+    template<typename T>
+    std::vector<std::vector<T>> nested(std::size_t n)
+    {
+        // Rows of 1 to 32 elements, n elements in all.
+        auto const flat = bench::random_data<T>(n);
+        std::vector<std::vector<T>> rows;
+        for(std::size_t i = 0; i < n;)
+        {
+            std::size_t const len = std::min<std::size_t>(n - i, 1 + (flat[i] > 0 ?
+                static_cast<std::size_t>(flat[i]) % 32 : 0));
+            rows.emplace_back(flat.begin() + i, flat.begin() + i + len);
+            i += len;
+        }
+        return rows;
+    }
+
+    template<typename T>
+    int register_views()
+    {
+        using namespace ranges;
+        using V = std::vector<T>;
+        auto const input = &data<T>;
+
+        compare<T>("all", input,
+            [](V const &v) { return sum<T>(view::all(v)); },
+            [](V const &v) { T s = 0; for(T t : v) s += t; return s; });
+        compare<T>("transform", input,
+            [](V const &v) { return sum<T>(v | view::transform([](T t) { return t * 2 + 1; })); },
+            [](V const &v) { T s = 0; for(T t : v) s += t * 2 + 1; return s; });
+        compare<T>("remove_if", input,
+            [](V const &v) { return sum<T>(v | view::remove_if([](T t) { return t < 500; })); },
+            [](V const &v) { T s = 0; for(T t : v) if(!(t < 500)) s += t; return s; });
+        // With unseq, the iterators filter 64 elements at a time through a mask.
+        compare<T>("remove_if_unseq", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::remove_if(unseq, [](T t) { return t < 500; }));
+            },
+            [](V const &v) { T s = 0; for(T t : v) if(!(t < 500)) s += t; return s; });
+        compare<T>("transform_remove_if", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::transform([](T t) { return t * 3; })
+                                | view::remove_if([](T t) { return t <= 1500; }));
+            },
+            [](V const &v) { T s = 0; for(T t : v) if(!(t * 3 <= 1500)) s += t * 3; return s; });
+        // A filter feeding a store, which copy and to_vector run a block at a
+        // time.
+        compare<T>("remove_if_copy", input,
+            [](V const &v)
+            {
+                static V out;
+                out.resize(v.size());
+                auto rng = v | view::remove_if([](T t) { return t < 500; });
+                auto res = copy(rng, out.begin());
+                return res.second - out.begin();
+            },
+            [](V const &v)
+            {
+                static V out;
+                out.resize(v.size());
+                auto o = out.begin();
+                for(T t : v)
+                    if(!(t < 500))
+                        *o++ = t;
+                return o - out.begin();
+            });
+        compare<T>("remove_if_to_vector", input,
+            [](V const &v)
+            {
+                return (v | view::remove_if([](T t) { return t < 500; }) | to_vector).size();
+            },
+            [](V const &v)
+            {
+                V out;
+                for(T t : v)
+                    if(!(t < 500))
+                        out.push_back(t);
+                return out.size();
+            });
+        // A three-stage pipeline, pulled through its iterators and then pushed
+        // through for_each_while by accumulate.
+        compare<T>("pipeline", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::remove_if([](T t) { return t < 10; })
+                                | view::transform([](T t) { return t * 3; })
+                                | view::take_while([](T t) { return t < 100000; }));
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T t : v)
+                {
+                    if(t < 10)
+                        continue;
+                    if(!(t * 3 < 100000))
+                        break;
+                    s += t * 3;
+                }
+                return s;
+            });
+        compare<T>("pipeline_accumulate", input,
+            [](V const &v)
+            {
+                auto rng = v | view::remove_if([](T t) { return t < 10; })
+                             | view::transform([](T t) { return t * 3; })
+                             | view::take_while([](T t) { return t < 100000; });
+                return accumulate(rng, T(0));
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T t : v)
+                {
+                    if(t < 10)
+                        continue;
+                    if(!(t * 3 < 100000))
+                        break;
+                    s += t * 3;
+                }
+                return s;
+            });
+        compare<T>("take", input,
+            [](V const &v) { return sum<T>(v | view::take(v.size() / 2)); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size() / 2; ++i)
+                    s += v[i];
+                return s;
+            });
+        compare<T>("drop", input,
+            [](V const &v) { return sum<T>(v | view::drop(v.size() / 2)); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = v.size() / 2; i < v.size(); ++i)
+                    s += v[i];
+                return s;
+            });
+        compare<T>("slice", input,
+            [](V const &v) { return sum<T>(v | view::slice(v.size() / 4, 3 * v.size() / 4)); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = v.size() / 4; i < 3 * v.size() / 4; ++i)
+                    s += v[i];
+                return s;
+            });
+        compare<T>("tail", input,
+            [](V const &v) { return sum<T>(v | view::tail); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    s += v[i];
+                return s;
+            });
+        compare<T>("stride", input,
+            [](V const &v) { return sum<T>(v | view::stride(3)); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); i += 3)
+                    s += v[i];
+                return s;
+            });
+        compare<T>("reverse", input,
+            [](V const &v) { return sum<T>(v | view::reverse); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = v.size(); i-- > 0;)
+                    s += v[i];
+                return s;
+            });
+        compare<T>("take_while", input,
+            [](V const &v) { return sum<T>(v | view::take_while([](T t) { return t < 999; })); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T t : v)
+                {
+                    if(!(t < 999))
+                        break;
+                    s += t;
+                }
+                return s;
+            });
+        compare<T>("drop_while", input,
+            [](V const &v) { return sum<T>(v | view::drop_while([](T t) { return t < 999; })); },
+            [](V const &v)
+            {
+                auto i = v.begin();
+                while(i != v.end() && *i < 999)
+                    ++i;
+                T s = 0;
+                for(; i != v.end(); ++i)
+                    s += *i;
+                return s;
+            });
+        compare<T>("iota", input,
+            [](V const &v) { return sum<T>(view::iota(std::size_t(0)) | view::take(v.size())); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    s += static_cast<T>(i);
+                return s;
+            });
+        compare<T>("zip", input,
+            [](V const &v)
+            {
+                T s = 0;
+                RANGES_FOR(auto p, view::zip(v, v | view::reverse))
+                    s += p.first * p.second;
+                return s;
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0, n = v.size(); i < n; ++i)
+                    s += v[i] * v[n - 1 - i];
+                return s;
+            });
+        compare<T>("zip_with", input,
+            [](V const &v)
+            {
+                return sum<T>(view::zip_with([](T a, T b) { return a * b; }, v, v));
+            },
+            [](V const &v) { T s = 0; for(T t : v) s += t * t; return s; });
+        compare<T>("concat", input,
+            [](V const &v) { return sum<T>(view::concat(v, v)); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T t : v)
+                    s += t;
+                for(T t : v)
+                    s += t;
+                return s;
+            });
+        // Every step through a concatenation dispatches on the current segment.
+        compare<T>("concat8", input,
+            [](V const &v) { return sum<T>(view::concat(v, v, v, v, v, v, v, v)); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(int i = 0; i < 8; ++i)
+                    for(T t : v)
+                        s += t;
+                return s;
+            });
+        compare<T>("concat16", input,
+            [](V const &v)
+            {
+                return sum<T>(view::concat(v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v));
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(int i = 0; i < 16; ++i)
+                    for(T t : v)
+                        s += t;
+                return s;
+            });
+        compare<T>("join", &nested<T>,
+            [](std::vector<V> &vv) { return sum<T>(vv | view::join); },
+            [](std::vector<V> const &vv)
+            {
+                T s = 0;
+                for(auto const &v : vv)
+                    for(T t : v)
+                        s += t;
+                return s;
+            });
+        // The same, but through algorithms that see join's segments.
+        compare<T>("join_accumulate", &nested<T>,
+            [](std::vector<V> &vv)
+            {
+                auto rng = vv | view::join;
+                return accumulate(rng, T(0));
+            },
+            [](std::vector<V> const &vv)
+            {
+                T s = 0;
+                for(auto const &v : vv)
+                    for(T t : v)
+                        s += t;
+                return s;
+            });
+        compare<T>("join_count", &nested<T>,
+            [](std::vector<V> &vv)
+            {
+                auto rng = vv | view::join;
+                return count(rng, T(42));
+            },
+            [](std::vector<V> const &vv)
+            {
+                std::ptrdiff_t n = 0;
+                for(auto const &v : vv)
+                    n += std::count(v.begin(), v.end(), T(42));
+                return n;
+            });
+        compare<T>("concat8_accumulate", input,
+            [](V const &v)
+            {
+                auto rng = view::concat(v, v, v, v, v, v, v, v);
+                return accumulate(rng, T(0));
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(int i = 0; i < 8; ++i)
+                    for(T t : v)
+                        s += t;
+                return s;
+            });
+        compare<T>("for_each", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::take(v.size() / 4) |
+                    view::for_each([](T t) { return view::repeat_n(t, 4); }));
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size() / 4; ++i)
+                    for(int j = 0; j < 4; ++j)
+                        s += v[i];
+                return s;
+            });
+        compare<T>("unique", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::transform([](T t) { return t / 100; }) | view::unique);
+            },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(i == 0 || v[i] / 100 != v[i - 1] / 100)
+                        s += v[i] / 100;
+                return s;
+            });
+        compare<T>("adjacent_remove_if", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::adjacent_remove_if([](T a, T b) { return a < b; }));
+            },
+            [](V const &v)
+            {
+                // Keeps each element that is not less than its successor.
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(i + 1 == v.size() || !(v[i] < v[i + 1]))
+                        s += v[i];
+                return s;
+            });
+        compare<T>("group_by", input,
+            [](V const &v)
+            {
+                return length(v | view::group_by([](T a, T b) { return a / 250 == b / 250; }));
+            },
+            [](V const &v)
+            {
+                std::size_t n = 0;
+                for(std::size_t i = 0, j; i < v.size(); i = j, ++n)
+                    for(j = i + 1; j < v.size() && v[i] / 250 == v[j] / 250; ++j)
+                        ;
+                return n;
+            });
+        compare<T>("partial_sum", input,
+            [](V const &v) { return sum<T>(v | view::partial_sum(std::plus<T>{})); },
+            [](V const &v)
+            {
+                T s = 0, acc = 0;
+                for(T t : v)
+                    s += (acc += t);
+                return s;
+            });
+        compare<T>("intersperse", input,
+            [](V const &v) { return sum<T>(v | view::intersperse(T(1))); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    s += i == 0 ? v[i] : v[i] + T(1);
+                return s;
+            });
+        compare<T>("replace", input,
+            [](V const &v) { return sum<T>(v | view::replace(T(0), T(1))); },
+            [](V const &v) { T s = 0; for(T t : v) s += t == T(0) ? T(1) : t; return s; });
+        compare<T>("replace_if", input,
+            [](V const &v)
+            {
+                return sum<T>(v | view::replace_if([](T t) { return t < 100; }, T(0)));
+            },
+            [](V const &v) { T s = 0; for(T t : v) s += t < 100 ? T(0) : t; return s; });
+        compare<T>("const", input,
+            [](V const &v) { return sum<T>(v | view::const_); },
+            [](V const &v) { T s = 0; for(T const &t : v) s += t; return s; });
+        compare<T>("move", input,
+            [](V const &v) { return sum<T>(v | view::move); },
+            [](V const &v) { T s = 0; for(T t : v) s += std::move(t); return s; });
+        compare<T>("counted", input,
+            [](V const &v) { return sum<T>(view::counted(v.data(), (std::ptrdiff_t)v.size())); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T const *p = v.data(), *e = p + v.size(); p != e; ++p)
+                    s += *p;
+                return s;
+            });
+        compare<T>("delimit", input,
+            [](V const &v) { return sum<T>(view::delimit(v, T(1000))); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T t : v)
+                {
+                    if(t == T(1000))
+                        break;
+                    s += t;
+                }
+                return s;
+            });
+        compare<T>("unbounded", input,
+            [](V const &v)
+            {
+                T s = 0;
+                auto i = ranges::begin(view::unbounded(v.data()));
+                for(std::size_t n = 0; n < v.size(); ++n, ++i)
+                    s += *i;
+                return s;
+            },
+            [](V const &v) { T s = 0; for(T t : v) s += t; return s; });
+        compare<T>("bounded", input,
+            [](V const &v) { return sum<T>(view::delimit(v, T(1000)) | view::bounded); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(T t : v)
+                {
+                    if(t == T(1000))
+                        break;
+                    s += t;
+                }
+                return s;
+            });
+        compare<T>("indirect", [](std::size_t n)
+            {
+                // The pointers point into a vector owned by the closure.
+                auto vals = std::make_shared<V>(data<T>(n));
+                std::vector<T const *> ptrs;
+                for(T const &t : *vals)
+                    ptrs.push_back(&t);
+                return std::make_pair(vals, ptrs);
+            },
+            [](std::pair<std::shared_ptr<V>, std::vector<T const *>> const &p)
+            {
+                return sum<T>(p.second | view::indirect);
+            },
+            [](std::pair<std::shared_ptr<V>, std::vector<T const *>> const &p)
+            {
+                T s = 0;
+                for(T const *t : p.second)
+                    s += *t;
+                return s;
+            });
+        compare<T>("keys", [](std::size_t n)
+            {
+                auto const d = data<T>(n);
+                std::vector<std::pair<T, int>> pairs;
+                for(T t : d)
+                    pairs.emplace_back(t, 0);
+                return pairs;
+            },
+            [](std::vector<std::pair<T, int>> const &v) { return sum<T>(v | view::keys); },
+            [](std::vector<std::pair<T, int>> const &v)
+            {
+                T s = 0;
+                for(auto const &p : v)
+                    s += p.first;
+                return s;
+            });
+        compare<T>("repeat_n", input,
+            [](V const &v) { return sum<T>(view::repeat_n(T(3), v.size())); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    s += T(3);
+                return s;
+            });
+        compare<T>("repeat", input,
+            [](V const &v) { return sum<T>(view::repeat(T(3)) | view::take(v.size())); },
+            [](V const &v)
+            {
+                T s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    s += T(3);
+                return s;
+            });
+        compare<T>("generate_n", input,
+            [](V const &v)
+            {
+                T i = 0;
+                return sum<T>(view::generate_n([i]() mutable { return i++; }, v.size()));
+            },
+            [](V const &v)
+            {
+                T s = 0, i = 0;
+                for(std::size_t n = 0; n < v.size(); ++n)
+                    s += i++;
+                return s;
+            });
+        compare<T>("split", input,
+            [](V const &v)
+            {
+                return length(v | view::transform([](T t) { return t / 100; }) |
+                    view::split(T(0)));
+            },
+            [](V const &v)
+            {
+                std::size_t n = v.empty() ? 0 : 1;
+                for(T t : v)
+                    n += t / 100 == T(0);
+                return n;
+            });
+        compare<T>("any_input_range", input,
+            [](V const &v) { return sum<T>(any_input_range<T const &>{v}); },
+            [](V const &v) { T s = 0; for(T t : v) s += t; return s; });
+        compare<T>("any_random_access_range", input,
+            [](V const &v) { return sum<T>(any_random_access_range<T const &>{v}); },
+            [](V const &v) { T s = 0; for(T t : v) s += t; return s; });
+        return 0;
+    }
+
+    RANGES_BENCH(register_views<int>());
+    RANGES_BENCH(register_views<std::int64_t>());
+    RANGES_BENCH(register_views<double>());
+
+    int register_string_views()
+    {
+        using namespace ranges;
+        auto const text = [](std::size_t n)
+        {
+            std::string s;
+            auto const d = bench::random_data<int>(n);
+            for(int i : d)
+                s += static_cast<char>(i % 10 == 0 ? ' ' : 'a' + i % 26);
+            return s;
+        };
+        compare<char>("c_str", text,
+            [](std::string const &s) { return length(view::c_str(s.c_str())); },
+            [](std::string const &s)
+            {
+                std::size_t n = 0;
+                for(char const *p = s.c_str(); *p; ++p)
+                    ++n;
+                return n;
+            });
+        compare<char>("split", text,
+            [](std::string const &s) { return length(s | view::split(' ')); },
+            [](std::string const &s)
+            {
+                std::size_t n = s.empty() ? 0 : 1;
+                for(char c : s)
+                    n += c == ' ';
+                return n;
+            });
+        compare<char>("tokenize", text,
+            [](std::string const &s)
+            {
+                static std::regex const word{"[a-z]+"};
+                return length(s | view::tokenize(word));
+            },
+            [](std::string const &s)
+            {
+                static std::regex const word{"[a-z]+"};
+                std::size_t n = 0;
+                for(std::sregex_token_iterator i{s.begin(), s.end(), word}, e; i != e; ++i)
+                    ++n;
+                return n;
+            });
+        compare<char>("tokenize_dfa", text,
+            [](std::string const &s)
+            {
+                static dfa_pattern const word{"[a-z]+"};
+                return length(s | view::tokenize(word));
+            },
+            [](std::string const &s)
+            {
+                std::size_t n = 0;
+                for(std::size_t i = 0; i != s.size();)
+                {
+                    if(s[i] < 'a' || s[i] > 'z')
+                    {
+                        ++i;
+                        continue;
+                    }
+                    while(i != s.size() && s[i] >= 'a' && s[i] <= 'z')
+                        ++i;
+                    ++n;
+                }
+                return n;
+            });
+        return 0;
+    }
+
+    RANGES_BENCH(register_string_views());
+}
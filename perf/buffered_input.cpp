@@ -0,0 +1,71 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares the throughput of istream_range and buffered_input_range when
+// summing a stream of whitespace-separated integers and doubles.
+//
+// Usage: buffered_input <element count>
+
+#include <random>
+#include <string>
+#include <cstdlib>
+#include <sstream>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/buffered_input_range.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "./timer.hpp"
+
+template<typename Val>
+std::string data(std::size_t n)
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> dist{-1000000, 1000000};
+    std::ostringstream out;
+    for(std::size_t i = 0; i < n; ++i)
+        out << (std::is_integral<Val>::value ? Val(dist(gen)) : Val(dist(gen)) / 1000)
+            << (i % 16 == 15 ? '\n' : ' ');
+    return out.str();
+}
+
+template<typename Val>
+void benchmark(char const *name, std::size_t n)
+{
+    std::string const text = data<Val>(n);
+    Val sum1, sum2;
+    long ms1, ms2;
+    {
+        std::istringstream sin{text};
+        timer t;
+        sum1 = ranges::accumulate(ranges::istream<Val>(sin), Val{});
+        ms1 = t.elapsed().count();
+    }
+    {
+        std::istringstream sin{text};
+        timer t;
+        sum2 = ranges::accumulate(ranges::view::buffered_input<Val>(sin), Val{});
+        ms2 = t.elapsed().count();
+    }
+    std::cout << name << "\tistream: " << ms1 << "ms\tbuffered_input: " << ms2 << "ms\t"
+        << (sum1 == sum2 ? "" : "MISMATCH") << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+        return -1;
+
+    std::size_t n = std::strtoul(argv[1], nullptr, 10);
+    benchmark<int>("int", n);
+    benchmark<double>("double", n);
+}
@@ -0,0 +1,93 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures how ranges::reduce(par(n), ...), ranges::inner_product(par(n), ...) and
+// ranges::reproducible_sum(par(n), ...) scale from 1 thread up to the number of
+// hardware threads.
+//
+// Usage: parallel_reduce <element count> [max threads]
+
+#include <random>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/numeric/inner_product.hpp>
+#include <range/v3/numeric/reproducible_sum.hpp>
+#include "./timer.hpp"
+
+std::vector<double> data(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen{seed};
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    std::vector<double> v(n);
+    for(auto &d : v)
+        d = dist(gen);
+    return v;
+}
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    double volatile sink = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        sink = sink + fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+        return -1;
+
+    std::size_t n = std::strtoul(argv[1], nullptr, 10);
+    unsigned max_threads = argc > 2 ? (unsigned)std::atoi(argv[2]) :
+        std::max(1u, std::thread::hardware_concurrency());
+    auto const a = data(n, 42), b = data(n, 43);
+
+    long reduce1 = 0, inner1 = 0, repro1 = 0;
+    std::cout << "threads\treduce(ms)\tspeedup\tinner_product(ms)\tspeedup"
+        "\treproducible_sum(ms)\tspeedup\n";
+    for(unsigned t = 1; t <= max_threads; t = (t < max_threads && t * 2 > max_threads) ?
+        max_threads : t * 2)
+    {
+        long reduce_ms = benchmark([&]
+        {
+            return ranges::reduce(ranges::par(t), a, 0.0);
+        });
+        long inner_ms = benchmark([&]
+        {
+            return ranges::inner_product(ranges::par(t), a, b, 0.0);
+        });
+        long repro_ms = benchmark([&]
+        {
+            return ranges::reproducible_sum(ranges::par(t), a);
+        });
+        if(t == 1)
+        {
+            reduce1 = reduce_ms;
+            inner1 = inner_ms;
+            repro1 = repro_ms;
+        }
+        std::cout << t << '\t' << reduce_ms << '\t' << (double)reduce1 / std::max(reduce_ms, 1L)
+            << '\t' << inner_ms << '\t' << (double)inner1 / std::max(inner_ms, 1L)
+            << '\t' << repro_ms << '\t' << (double)repro1 / std::max(repro_ms, 1L) << '\n';
+    }
+}
@@ -0,0 +1,86 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures how ranges::exclusive_scan(par(n), ...) scales from 1 thread up to the
+// number of hardware threads, turning row lengths into the row offsets of a
+// compressed sparse row matrix, against std::partial_sum.
+//
+// Usage: parallel_scan <element count> [max threads]
+
+#include <random>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <iostream>
+#include <range/v3/numeric/scan.hpp>
+#include "./timer.hpp"
+
+std::vector<std::int64_t> data(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen{seed};
+    std::uniform_int_distribution<std::int64_t> dist{0, 64};
+    std::vector<std::int64_t> v(n);
+    for(auto &i : v)
+        i = dist(gen);
+    return v;
+}
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+        return -1;
+
+    std::size_t n = std::strtoul(argv[1], nullptr, 10);
+    unsigned max_threads = argc > 2 ? (unsigned)std::atoi(argv[2]) :
+        std::max(1u, std::thread::hardware_concurrency());
+    auto const sizes = data(n, 42);
+    std::vector<std::int64_t> offsets(n);
+
+    long std_ms = benchmark([&]
+    {
+        offsets[0] = 0;
+        std::partial_sum(sizes.begin(), sizes.end() - 1, offsets.begin() + 1);
+    });
+    std::cout << "std::partial_sum(ms)\t" << std_ms << '\n';
+
+    long scan1 = 0;
+    std::cout << "threads\texclusive_scan(ms)\tspeedup\n";
+    for(unsigned t = 1; t <= max_threads; t = (t < max_threads && t * 2 > max_threads) ?
+        max_threads : t * 2)
+    {
+        long scan_ms = benchmark([&]
+        {
+            ranges::exclusive_scan(ranges::par(t), sizes, offsets.begin(), std::int64_t{0});
+        });
+        if(t == 1)
+            scan1 = scan_ms;
+        std::cout << t << '\t' << scan_ms << '\t' << (double)scan1 / std::max(scan_ms, 1L)
+            << '\n';
+    }
+}
@@ -0,0 +1,90 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures how ranges::sort(par(n), ...) and ranges::stable_sort(par(n), ...)
+// scale from 1 thread up to the number of hardware threads.
+//
+// Usage: parallel_sort <element count> [max threads]
+
+#include <random>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include "./timer.hpp"
+
+struct record
+{
+    std::uint64_t id;
+    std::uint64_t payload[3];
+};
+
+std::vector<record> data(std::size_t n)
+{
+    std::mt19937_64 gen{42};
+    std::vector<record> v(n);
+    for(auto &r : v)
+        r.id = gen();
+    return v;
+}
+
+constexpr int cloops = 3;
+
+template<typename Sort>
+long benchmark(std::vector<record> const &input, Sort sort)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        auto v = input;
+        timer t;
+        sort(v);
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+        return -1;
+
+    std::size_t n = std::strtoul(argv[1], nullptr, 10);
+    unsigned max_threads = argc > 2 ? (unsigned)std::atoi(argv[2]) :
+        std::max(1u, std::thread::hardware_concurrency());
+    auto const input = data(n);
+
+    long sort1 = 0, stable1 = 0;
+    std::cout << "threads\tsort(ms)\tspeedup\tstable_sort(ms)\tspeedup\n";
+    for(unsigned t = 1; t <= max_threads; t = (t < max_threads && t * 2 > max_threads) ?
+        max_threads : t * 2)
+    {
+        long sort_ms = benchmark(input, [=](std::vector<record> &v)
+        {
+            ranges::sort(ranges::par(t), v, std::less<std::uint64_t>{}, &record::id);
+        });
+        long stable_ms = benchmark(input, [=](std::vector<record> &v)
+        {
+            ranges::stable_sort(ranges::par(t), v, std::less<std::uint64_t>{}, &record::id);
+        });
+        if(t == 1)
+        {
+            sort1 = sort_ms;
+            stable1 = stable_ms;
+        }
+        std::cout << t << '\t' << sort_ms << '\t' << (double)sort1 / std::max(sort_ms, 1L)
+            << '\t' << stable_ms << '\t' << (double)stable1 / std::max(stable_ms, 1L) << '\n';
+    }
+}
@@ -0,0 +1,43 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_PERF_TIMER_HPP
+#define RANGES_PERF_TIMER_HPP
+
+#include <chrono>
+#include <iostream>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+#endif
@@ -0,0 +1,104 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares to_vector against constructing the vector from a pair of common
+// iterators, which is what to_vector used to do, for input ranges with and
+// without a known size.
+//
+// Usage: to_container_perf <element count>
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <range/v3/core.hpp>
+#include <range/v3/view/counted.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/take_while.hpp>
+#include "./timer.hpp"
+
+template<typename It>
+struct input_iterator
+{
+    It it_;
+public:
+    typedef          std::input_iterator_tag                   iterator_category;
+    typedef typename std::iterator_traits<It>::value_type      value_type;
+    typedef typename std::iterator_traits<It>::difference_type difference_type;
+    typedef It                                                 pointer;
+    typedef typename std::iterator_traits<It>::reference       reference;
+
+    input_iterator() : it_() {}
+    explicit input_iterator(It it) : it_(it) {}
+
+    reference operator*() const {return *it_;}
+    pointer operator->() const {return it_;}
+
+    input_iterator& operator++() {++it_; return *this;}
+    input_iterator operator++(int)
+        {input_iterator tmp(*this); ++(*this); return tmp;}
+
+    friend bool operator==(const input_iterator& x, const input_iterator& y)
+        {return x.it_ == y.it_;}
+    friend bool operator!=(const input_iterator& x, const input_iterator& y)
+        {return !(x == y);}
+};
+
+template<typename Rng>
+std::vector<long> old_to_vector(Rng && rng)
+{
+    using I = ranges::range_common_iterator_t<Rng>;
+    return std::vector<long>(I{ranges::begin(rng)}, I{ranges::end(rng)});
+}
+
+constexpr int cloops = 10;
+
+template<typename MakeRng>
+void benchmark(char const *name, MakeRng make_rng)
+{
+    long old_ms = 0, new_ms = 0;
+    std::size_t check = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        check += old_to_vector(make_rng()).size();
+        old_ms += t.elapsed().count();
+        t.reset();
+        check += (make_rng() | ranges::to_<std::vector<long>>()).size();
+        new_ms += t.elapsed().count();
+    }
+    std::cout << name << " : old " << old_ms / cloops << "ms, new " << new_ms / cloops
+        << "ms (" << check << ")\n";
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+        return -1;
+
+    int n = std::atoi(argv[1]);
+    std::vector<int> data(n);
+    for(int i = 0; i < n; ++i)
+        data[i] = i;
+    using I = input_iterator<int const *>;
+    auto square = [](int i) { return (long)i * i; };
+
+    benchmark("sized input   ", [&]
+    {
+        return ranges::view::counted(I{data.data()}, n) | ranges::view::transform(square);
+    });
+    benchmark("unsized input ", [&]
+    {
+        return ranges::view::counted(I{data.data()}, n) | ranges::view::transform(square)
+            | ranges::view::take_while([](long i) { return i >= 0; });
+    });
+}
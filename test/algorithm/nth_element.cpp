@@ -88,5 +88,9 @@ int main()
     CHECK(ia[M].i == M);
     CHECK(ia[M].j == M);
 
+    std::random_shuffle(ia, ia+N);
+    ranges::nth_element(ranges::par, ia, ia+M, std::less<int>(), &S::i);
+    CHECK(ia[M].i == M);
+
     return test_result();
 }
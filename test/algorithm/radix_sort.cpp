@@ -0,0 +1,118 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct S
+{
+    std::int64_t key;
+    int seq;
+};
+
+template<typename T>
+void test_keys(std::vector<T> v)
+{
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    auto end = ranges::radix_sort(v);
+    CHECK(end == v.end());
+    CHECK(v == expected);
+}
+
+int main()
+{
+    std::mt19937_64 gen{0};
+
+    {
+        std::vector<int> v(1000);
+        for(auto &i : v)
+            i = (int)gen();
+        test_keys(v);
+        test_keys(std::vector<int>{});
+        test_keys(std::vector<int>{42});
+        test_keys(std::vector<int>{3, -1, 2, -7, 0, 2});
+    }
+
+    {
+        std::vector<std::uint64_t> v(1000);
+        for(auto &i : v)
+            i = gen();
+        test_keys(v);
+    }
+
+    {
+        std::vector<signed char> v(300);
+        for(auto &i : v)
+            i = (signed char)gen();
+        test_keys(v);
+    }
+
+    {
+        std::vector<double> v(1000);
+        std::uniform_real_distribution<double> dist(-1e6, 1e6);
+        for(auto &d : v)
+            d = dist(gen);
+        v[0] = -std::numeric_limits<double>::infinity();
+        v[1] = std::numeric_limits<double>::infinity();
+        test_keys(v);
+
+        std::vector<float> w{1.5f, -0.0f, 0.0f, -2.5f, 3.0f, -0.0f};
+        ranges::radix_sort(w);
+        CHECK(w[0] == -2.5f);
+        CHECK(std::signbit(w[1]));
+        CHECK(std::signbit(w[2]));
+        CHECK(!std::signbit(w[3]));
+        CHECK(w[4] == 1.5f);
+        CHECK(w[5] == 3.0f);
+    }
+
+    {
+        std::vector<char> v{1, 0, 1, 1, 0};
+        ranges::radix_sort(v, [](char c) { return c != 0; });
+        ::check_equal(v, {0, 0, 1, 1, 1});
+    }
+
+    // Check projections and stability
+    {
+        std::vector<S> v(5000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = S{(std::int64_t)(gen() % 100) - 50, i};
+        ranges::radix_sort(v.begin(), v.end(), &S::key);
+        for(std::size_t i = 1; i < v.size(); ++i)
+        {
+            CHECK(v[i-1].key <= v[i].key);
+            if(v[i-1].key == v[i].key)
+                CHECK(v[i-1].seq < v[i].seq);
+        }
+    }
+
+    // Check move-only types
+    {
+        std::vector<std::unique_ptr<int>> v(1000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i].reset(new int((int)v.size() - i - 1));
+        ranges::radix_sort(v, [](std::unique_ptr<int> const &p) { return *p; });
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            CHECK(*v[i] == i);
+    }
+
+    return ::test_result();
+}
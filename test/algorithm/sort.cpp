@@ -303,5 +303,25 @@ int main()
         sort(rng);
     }
 
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = (int)((i * 7919L) % v.size());
+            v[i].j = i;
+        }
+        auto end = ranges::sort(ranges::par(4), v, std::less<int>{}, &S::i);
+        CHECK(end == v.end());
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            CHECK(v[i].i == i);
+
+        std::vector<int> w(100000);
+        for(int i = 0; (std::size_t)i < w.size(); ++i)
+            w[i] = (int)w.size() - i;
+        ranges::sort(ranges::par, w.begin(), w.end());
+        CHECK(std::is_sorted(w.begin(), w.end()));
+    }
+
     return ::test_result();
 }
@@ -212,5 +212,58 @@ int main()
         }
     }
 
+    // Check that the default ordering on an integral key stays stable
+    {
+        std::vector<S> v(1000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = (int)(v.size() - i - 1) % 10 - 5;
+            v[i].j = i;
+        }
+        ranges::stable_sort(v, ranges::ordered_less{}, &S::i);
+        for(int i = 1; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i-1].i <= v[i].i);
+            if(v[i-1].i == v[i].i)
+                CHECK(v[i-1].j < v[i].j);
+        }
+    }
+
+    // Check the parallel overloads, which must preserve the order of equal keys
+    {
+        std::vector<S> v(100000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = (int)(v.size() - i - 1) % 100;
+            v[i].j = i;
+        }
+        ranges::stable_sort(ranges::par(4), v, std::less<int>{}, &S::i);
+        for(int i = 1; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i-1].i <= v[i].i);
+            if(v[i-1].i == v[i].i)
+                CHECK(v[i-1].j < v[i].j);
+        }
+    }
+
+    // ... also when the elements are move-only and own resources, which the
+    // parallel merge moves out to a buffer and back.
+    {
+        std::vector<std::pair<int, std::unique_ptr<int>>> v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].first = (int)(v.size() - i - 1) % 100;
+            v[i].second.reset(new int(i));
+        }
+        ranges::stable_sort(ranges::par(4), v, std::less<int>{},
+            &std::pair<int, std::unique_ptr<int>>::first);
+        for(int i = 1; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i-1].first <= v[i].first);
+            if(v[i-1].first == v[i].first)
+                CHECK(*v[i-1].second < *v[i].second);
+        }
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,106 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <range/v3/core.hpp>
+#include <range/v3/buffered_input_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+#if RANGES_HAVE_UNISTD_H
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+template<typename Val>
+std::vector<Val> parse(std::string const &str, std::size_t block_size)
+{
+    std::istringstream sin{str};
+    return ranges::to_vector(ranges::view::buffered_input<Val>(sin, block_size));
+}
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::istringstream sin{"1 2 3"};
+        ::models<concepts::InputRange>(view::buffered_input<int>(sin));
+        ::models_not<concepts::ForwardRange>(view::buffered_input<int>(sin));
+    }
+
+    // Tokens straddling block boundaries, and runs of mixed whitespace.
+    std::string const ints = "  1 -22\t333\n-4444 +55555\r\n666666 7777777  ";
+    for(std::size_t block_size : {1u, 2u, 3u, 7u, 64u, 65536u})
+        ::check_equal(parse<int>(ints, block_size),
+            {1, -22, 333, -4444, 55555, 666666, 7777777});
+
+    CHECK(parse<int>("", 16).empty());
+    CHECK(parse<int>(" \n\t ", 16).empty());
+
+    // Limits and overflow.
+    std::ostringstream limits;
+    limits << std::numeric_limits<long long>::min() << ' '
+           << std::numeric_limits<long long>::max();
+    ::check_equal(parse<long long>(limits.str(), 5),
+        {std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max()});
+    ::check_equal(parse<short>("32767 32768 1", 4), {short(32767)});
+    ::check_equal(parse<unsigned>("4294967295 -1", 4), {4294967295u});
+
+    // Parsing stops at the first malformed token, like istream_range.
+    ::check_equal(parse<int>("1 2 x3 4", 3), {1, 2});
+    ::check_equal(parse<int>("1 2- 3", 3), {1});
+
+    // Floating point, on the fast path and off it.
+    std::string const doubles =
+        "0 1.5 -2.25 3e2 .5 6. 1e-5 123456789012345678901234567890 1e300 -7.5E-300 0.1";
+    auto ds = parse<double>(doubles, 5);
+    ::check_equal(ds, {0.0, 1.5, -2.25, 300.0, 0.5, 6.0, 1e-5,
+        123456789012345678901234567890.0, 1e300, -7.5E-300, 0.1});
+    ::check_equal(parse<float>("0.1 -3.75 1e20", 3), {0.1f, -3.75f, 1e20f});
+    ::check_equal(parse<double>("1.5 e5 2", 64), {1.5});
+    ::check_equal(parse<double>("1.5 1e 2", 64), {1.5});
+
+    // Straight from a stream buffer.
+    {
+        std::stringstream ss;
+        ss << "10 20 30";
+        ::check_equal(view::buffered_input<int>(*ss.rdbuf(), 2), {10, 20, 30});
+    }
+
+#if RANGES_HAVE_UNISTD_H
+    // From a file descriptor.
+    {
+        char const *path = "buffered_input_range_test.txt";
+        {
+            std::ofstream out(path);
+            for(int i = 0; i < 10000; ++i)
+                out << i << (i % 10 == 9 ? '\n' : ' ');
+        }
+        int fd = ::open(path, O_RDONLY);
+        CHECK(fd != -1);
+        auto v = to_vector(view::buffered_input<int>(fd, 100));
+        ::close(fd);
+        std::remove(path);
+        CHECK(v.size() == 10000u);
+        ::check_equal(v, view::iota(0) | view::take(10000));
+    }
+#endif
+
+    return ::test_result();
+}
@@ -0,0 +1,109 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <numeric>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/for_each_block.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/replace_if.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // Enough elements to span several blocks, with a partial one at the end.
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+    auto is_odd = [](int i){ return i % 2 == 1; };
+    auto triple = [](int i){ return i * 3; };
+
+    auto rng = v | view::remove_if(is_odd) | view::transform(triple)
+        | view::replace_if([](int i){ return i % 4 == 0; }, -1);
+    static_assert(detail::has_for_each_block<decltype(rng)>::value, "");
+    static_assert(detail::use_blocks<decltype(rng)>::value, "");
+    auto const expected = [&]
+    {
+        std::vector<int> res;
+        for(int i : rng)
+            res.push_back(i);
+        return res;
+    }();
+    CHECK(expected.size() == 500u);
+
+    std::vector<int> blocked;
+    std::ptrdiff_t blocks = 0;
+    for_each_block(rng, [&](int const *p, std::ptrdiff_t n)
+    {
+        CHECK(n > 0);
+        CHECK(n <= 256);
+        ++blocks;
+        blocked.insert(blocked.end(), p, p + n);
+    });
+    CHECK(blocked == expected);
+    // remove_if halves each of the four source blocks.
+    CHECK(blocks == 4);
+
+    // copy and to_vector consume whole blocks.
+    CHECK(accumulate(rng, 0) == accumulate(expected, 0));
+    std::vector<int> out(500);
+    auto res = copy(rng, out.begin());
+    CHECK(res.first == end(rng));
+    CHECK(res.second == out.end());
+    CHECK(out == expected);
+    CHECK((rng | to_vector) == expected);
+
+    // A const view over a const-iterable base.
+    auto const crng = v | view::transform(triple);
+    static_assert(detail::has_for_each_block<decltype(crng)>::value, "");
+    // Nothing filters, so algorithms leave it to the compiler to fuse.
+    static_assert(!detail::use_blocks<decltype(crng)>::value, "");
+    int sum = 0;
+    for_each_block(crng, [&](int const *p, std::ptrdiff_t n)
+    {
+        for(std::ptrdiff_t i = 0; i < n; ++i)
+            sum += p[i];
+    });
+    CHECK(sum == 3 * 999 * 1000 / 2);
+    CHECK(accumulate(crng, 0) == 3 * 999 * 1000 / 2);
+    ::check_equal(crng | to_vector, v | view::transform(triple));
+
+    // Removing everything pushes no blocks.
+    auto none = v | view::remove_if([](int){ return true; });
+    for_each_block(none, [&](int const *, std::ptrdiff_t){ CHECK(false); });
+    CHECK((none | to_vector).empty());
+
+    // Not numbers, a function that wants a mutable reference, or a source that
+    // is not contiguous: iterate as before.
+    std::vector<std::string> strs{"a", "b"};
+    auto srng = strs | view::transform([](std::string const &s){ return s + s; });
+    static_assert(!detail::has_for_each_block<decltype(srng)>::value, "");
+    CHECK(accumulate(srng, std::string{}) == "aabb");
+    auto mrng = v | view::transform([](int &i){ return i; });
+    static_assert(!detail::has_for_each_block<decltype(mrng)>::value, "");
+    CHECK(accumulate(mrng, 0) == 999 * 1000 / 2);
+    auto irng = view::iota(0, 999) | view::transform(triple);
+    static_assert(!detail::has_for_each_block<decltype(irng)>::value, "");
+    auto trng = v | view::take_while([](int i){ return i < 10; }) | view::transform(triple);
+    static_assert(!detail::has_for_each_block<decltype(trng)>::value, "");
+    CHECK(accumulate(trng, 0) == 135);
+
+    return ::test_result();
+}
@@ -0,0 +1,85 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/for_each_while.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{1,2,3,4,5,6,7,8,9,10};
+    auto is_odd = [](int i){ return i % 2 == 1; };
+    auto square = [](int i){ return i * i; };
+    auto small = [](int i){ return i < 50; };
+
+    auto rng = v | view::remove_if(is_odd) | view::transform(square) | view::take_while(small);
+    static_assert(detail::has_for_each_while<decltype(rng)>::value, "");
+    ::check_equal(rng, {4, 16, 36});
+
+    // The sink sees the same elements the iterators do, and the returned
+    // iterator names the element it declined.
+    std::vector<int> seen;
+    auto it = for_each_while(rng, [&](int i){ seen.push_back(i); return i < 16; });
+    ::check_equal(seen, {4, 16});
+    CHECK(*it == 16);
+    CHECK(it != end(rng));
+    CHECK(distance(begin(rng), it) == 1);
+
+    it = for_each_while(rng, [](int){ return true; });
+    CHECK(it == end(rng));
+
+    auto const crng = v | view::transform(square) | view::take_while(small);
+    static_assert(detail::has_for_each_while<decltype(crng)>::value, "");
+    auto cit = for_each_while(crng, [](int i){ return i < 36; });
+    CHECK(*cit == 36);
+
+    // Terminal algorithms take the push path.
+    CHECK(accumulate(rng, 0) == 56);
+    CHECK(*find_if(rng, [](int i){ return i > 10; }) == 16);
+    CHECK(find_if(rng, [](int i){ return i > 100; }) == end(rng));
+    int sum = 0;
+    CHECK(for_each(rng, [&](int i){ sum += i; }) == end(rng));
+    CHECK(sum == 56);
+    int out[3] = {};
+    auto res = copy(rng, out);
+    CHECK(res.first == end(rng));
+    CHECK(res.second == out + 3);
+    ::check_equal(out, {4, 16, 36});
+    ::check_equal(rng | to_vector, {4, 16, 36});
+
+    // Pushing into a segmented base.
+    std::vector<std::vector<int>> vv{{1,2},{},{3,4,5},{6}};
+    auto jrng = vv | view::join | view::transform(square) | view::remove_if(is_odd);
+    ::check_equal(jrng, {4, 16, 36});
+    CHECK(accumulate(jrng, 0) == 56);
+    CHECK(*find_if(jrng, [](int i){ return i > 10; }) == 16);
+    ::check_equal(jrng | to_vector, {4, 16, 36});
+
+    // A non-const transform function still pushes through a non-const view.
+    int calls = 0;
+    auto mrng = v | view::transform([calls](int i) mutable { return ++calls, i; });
+    CHECK(accumulate(mrng, 0) == 55);
+
+    return ::test_result();
+}
@@ -0,0 +1,118 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <string>
+#include <cstdint>
+#include <fstream>
+#include <system_error>
+#include <range/v3/core.hpp>
+#include <range/v3/mmap_range.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/tokenize.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+#if RANGES_HAVE_POSIX_MMAP
+
+struct to_string
+{
+    template<typename Rng>
+    std::string operator()(Rng const &rng) const
+    {
+        return ranges::to_<std::string>(rng);
+    }
+};
+
+std::string write_file(char const *name, std::string const &contents)
+{
+    std::string path = std::string("mmap_range_test_") + name;
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+    return path;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::string path = write_file("chars", "abc,def,ghi");
+    {
+        auto rng = view::mapped_chars(path);
+        ::models<concepts::RandomAccessRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        CHECK(rng.size() == 11u);
+        ::check_equal(rng, std::string("abc,def,ghi"));
+
+        auto pieces = view::split(rng, ',') | view::transform(to_string{});
+        ::check_equal(pieces, {"abc","def","ghi"});
+
+        auto toks = view::tokenize(rng, std::regex{"[a-z]+"});
+        ::check_equal(toks, {"abc","def","ghi"});
+
+        // Copies share the mapping.
+        auto copy = rng;
+        CHECK(copy.data() == rng.data());
+    }
+    std::remove(path.c_str());
+
+    path = write_file("ints", std::string("\x01\x00\x00\x00\x02\x00\x00\x00\x03", 9));
+    {
+        auto rng = mmap_file<std::uint32_t>(path, mmap_advice::random);
+        CHECK(rng.size() == 2u);
+        bool const little = rng[0] == 1u && rng[1] == 2u;
+        bool const big = rng[0] == 0x01000000u && rng[1] == 0x02000000u;
+        CHECK((little || big));
+    }
+    std::remove(path.c_str());
+
+    path = write_file("empty", "");
+    {
+        auto rng = view::mapped_chars(path);
+        CHECK(rng.empty());
+    }
+    std::remove(path.c_str());
+
+    bool threw = false;
+    try
+    {
+        view::mapped_chars("mmap_range_test_does_not_exist");
+    }
+    catch(std::system_error const &)
+    {
+        threw = true;
+    }
+    CHECK(threw);
+
+    // A directory, like a pipe or a device, isn't a regular file.
+    threw = false;
+    try
+    {
+        view::mapped_chars(".");
+    }
+    catch(std::system_error const &)
+    {
+        threw = true;
+    }
+    CHECK(threw);
+
+    return ::test_result();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -19,6 +19,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cmath>
+#include <list>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
@@ -75,5 +78,34 @@ int main()
     CHECK(ranges::accumulate({1, 2, 3, 4, 5, 6}, S{10}, &S::add).i == 31);
     CHECK(ranges::accumulate({S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
 
+    // Check the unsequenced overloads, at every length up to a few vectors of
+    // partial results and then some.
+    for(int n = 0; n < 150; ++n)
+    {
+        std::vector<double> d(n);
+        std::vector<float> f(n);
+        for(int i = 0; i < n; ++i)
+        {
+            d[i] = 1.0 + (i % 5) * 0.25;
+            f[i] = 1.0f + (i % 3) * 0.5f;
+        }
+        double const dsum = ranges::accumulate(d, 1.5);
+        CHECK(std::fabs(ranges::accumulate(ranges::unseq, d, 1.5) - dsum) <= 1e-12 * dsum);
+        float const fsum = ranges::accumulate(f, 0.0f);
+        CHECK(std::fabs(ranges::accumulate(ranges::unseq, f.begin(), f.end(), 0.0f) - fsum) <=
+            1e-5f * fsum);
+        std::vector<double> p(n, 1.0);
+        for(int i = 0; i < n; ++i)
+            p[i] = i % 7 == 0 ? 2.0 : (i % 7 == 1 ? 0.5 : 1.0);
+        double const prod = ranges::accumulate(p, 3.0, ranges::multiplies{});
+        CHECK(ranges::accumulate(ranges::unseq, p, 3.0, ranges::multiplies{}) == prod);
+    }
+    // Folds the kernels don't handle are done in order.
+    std::list<int> l{1, 2, 3, 4};
+    CHECK(ranges::accumulate(ranges::unseq, l, 10) == 20);
+    CHECK(ranges::accumulate(ranges::unseq, {S{1}, S{2}}, 10, ranges::plus{}, &S::i) == 13);
+    std::vector<float> f{1.5f, 2.5f};
+    CHECK(ranges::accumulate(ranges::unseq, f, 1.0) == 5.0);
+
     return ::test_result();
 }
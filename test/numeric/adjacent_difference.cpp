@@ -22,6 +22,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
+#include <cstdint>
 #include <range/v3/core.hpp>
 #include <range/v3/numeric/adjacent_difference.hpp>
 #include "../simple_test.hpp"
@@ -32,6 +34,28 @@ struct S
     int i;
 };
 
+// Every length up to a few vectors, in place and not.
+template <class T> void test_contiguous()
+{
+    using ranges::adjacent_difference;
+    for(std::size_t n = 0; n < 40; ++n)
+    {
+        std::vector<T> v(n);
+        for(std::size_t i = 0; i < n; ++i)
+            v[i] = static_cast<T>(i * i % 11) - static_cast<T>(i % 3);
+        std::vector<T> expected(n);
+        for(std::size_t i = 0; i < n; ++i)
+            expected[i] = i == 0 ? v[0] : static_cast<T>(v[i] - v[i - 1]);
+        std::vector<T> out(n);
+        auto r = adjacent_difference(v, out.begin());
+        CHECK(r.first == v.end());
+        CHECK(r.second == out.end());
+        CHECK(out == expected);
+        adjacent_difference(v.begin(), v.end(), v.begin());
+        CHECK(v == expected);
+    }
+}
+
 template <class InIter, class OutIter, class InSent = InIter> void test()
 {
     using ranges::adjacent_difference;
@@ -175,5 +199,11 @@ int main()
         }
     }
 
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<std::int64_t>();
+    test_contiguous<float>();
+    test_contiguous<double>();
+
     return ::test_result();
 }
@@ -0,0 +1,97 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/delta_encode.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+using bytes = std::vector<std::uint8_t>;
+
+template<typename Rng>
+bytes encode(Rng &rng)
+{
+    bytes b;
+    ranges::delta_encode(rng, ranges::back_inserter(b));
+    return b;
+}
+
+// The same bytes for contiguous ranges, which take the vector kernel, as for
+// lists, which don't; across block boundaries and with every tail length.
+template<typename T>
+void test_same_bytes()
+{
+    for(std::size_t n : {0, 1, 7, 8, 9, 255, 256, 257, 1000})
+    {
+        // Step in the unsigned type, so that wrapping around is well-defined.
+        using U = ranges::meta::eval<std::make_unsigned<T>>;
+        std::vector<T> v(n);
+        T t = std::numeric_limits<T>::max() - 5;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            U const step = i % 3 == 0 ? static_cast<U>(U(0) - U(300)) : U(i % 200);
+            v[i] = t = static_cast<T>(static_cast<U>(static_cast<U>(t) + step));
+        }
+        std::list<T> l(v.begin(), v.end());
+        bytes const b = encode(v);
+        CHECK(b == encode(l));
+        CHECK(b.size() >= n);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Ascending ids a small step apart take a byte each.
+    {
+        std::vector<std::uint32_t> ids = {3, 4, 10, 137, 138};
+        ::check_equal(encode(ids), {3, 1, 6, 127, 1});
+        std::vector<std::uint64_t> big = {300, 16384};
+        ::check_equal(encode(big), {0xac, 0x02, 0xd4, 0x7d});
+    }
+
+    // Signed differences are zigzagged.
+    {
+        std::vector<int> v = {0, -1, 0, 1, -63, 1};
+        ::check_equal(encode(v), {0, 1, 2, 2, 127, 0x80, 0x01});
+    }
+
+    // Unsigned steps backwards wrap around.
+    {
+        std::vector<std::uint16_t> v = {1, 0};
+        ::check_equal(encode(v), {1, 0xff, 0xff, 0x03});
+    }
+
+    // Iterators, input ranges and an output pointer.
+    {
+        short s[] = {5, 6, 7};
+        std::uint8_t out[8] = {0};
+        auto r = delta_encode(input_iterator<short const *>(s), sentinel<short const *>(s + 3),
+            out + 0);
+        CHECK(base(r.first) == s + 3);
+        CHECK(r.second == out + 3);
+        ::check_equal(out, {10, 2, 2, 0, 0, 0, 0, 0});
+    }
+
+    test_same_bytes<int>();
+    test_same_bytes<unsigned>();
+    test_same_bytes<std::int64_t>();
+    test_same_bytes<std::uint64_t>();
+
+    return ::test_result();
+}
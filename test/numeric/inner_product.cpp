@@ -22,6 +22,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cmath>
+#include <list>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/numeric/inner_product.hpp>
 #include <range/v3/algorithm/equal.hpp>
@@ -187,5 +190,53 @@ int main()
         CHECK(ranges::inner_product(a, b, 10) == 66);
     }
 
+    // Check the parallel overloads
+    {
+        std::vector<long long> a(200000), b(200000);
+        for(int i = 0; i < 200000; ++i)
+        {
+            a[i] = i % 10;
+            b[i] = i % 7;
+        }
+        long long const expected = ranges::inner_product(a, b, 5LL);
+        CHECK(ranges::inner_product(ranges::par(4), a, b, 5LL) == expected);
+        CHECK(ranges::inner_product(ranges::par(4), a.begin(), a.end(), b.begin(), 5LL) ==
+            expected);
+        std::list<long long> l(b.begin(), b.begin() + 100000);
+        CHECK(ranges::inner_product(ranges::par(4), a, l, 0LL) ==
+            ranges::inner_product(a.begin(), a.begin() + 100000, b.begin(), 0LL));
+        std::vector<S> s(100000, S{3});
+        CHECK(ranges::inner_product(ranges::par(4), s, s, 0, std::plus<int>(),
+            std::multiplies<int>(), &S::i, &S::i) == 900000);
+    }
+
+    // Check the unsequenced overloads
+    for(int n = 0; n < 150; ++n)
+    {
+        std::vector<double> a(n), b(n + 3);
+        std::vector<float> fa(n), fb(n);
+        for(int i = 0; i < n; ++i)
+        {
+            a[i] = 1.0 + (i % 5) * 0.25;
+            b[i] = 2.0 - (i % 3) * 0.5;
+            fa[i] = static_cast<float>(a[i]);
+            fb[i] = static_cast<float>(b[i]);
+        }
+        double const dot = ranges::inner_product(a.begin(), a.end(), b.begin(), 0.5);
+        CHECK(std::fabs(ranges::inner_product(ranges::unseq, a, b, 0.5) - dot) <= 1e-12 * dot);
+        CHECK(std::fabs(ranges::inner_product(ranges::unseq, a.begin(), a.end(), b.begin(),
+            0.5) - dot) <= 1e-12 * dot);
+        float const fdot = ranges::inner_product(fa, fb, 0.0f);
+        CHECK(std::fabs(ranges::inner_product(ranges::unseq, fa, fb, 0.0f) - fdot) <=
+            1e-5f * fdot);
+    }
+    {
+        std::vector<S> s(10, S{3});
+        CHECK(ranges::inner_product(ranges::unseq, s, s, 0, std::plus<int>(),
+            std::multiplies<int>(), &S::i, &S::i) == 90);
+        std::vector<int> i{1, 2, 3};
+        CHECK(ranges::inner_product(ranges::unseq, i, i, 0) == 14);
+    }
+
     return ::test_result();
 }
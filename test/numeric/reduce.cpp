@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    // Sequential, as accumulate.
+    int ia[] = {1, 2, 3, 4, 5, 6};
+    CHECK(reduce(ia, 10) == 31);
+    CHECK(reduce(forward_iterator<int const *>(ia), forward_iterator<int const *>(ia + 6), 0) == 21);
+    CHECK(reduce({S{1}, S{2}, S{3}}, 0, plus{}, &S::i) == 6);
+    CHECK(transform_reduce(ia, 0, plus{}, [](int i) { return i * i; }) == 91);
+
+    // Enough elements to be cut into several pieces.
+    std::vector<std::int64_t> v(300001);
+    std::iota(v.begin(), v.end(), 0);
+    std::int64_t const sum = 300000ll * 300001 / 2;
+    CHECK(reduce(par(4), v, std::int64_t{0}) == sum);
+    CHECK(reduce(par(4), v, std::int64_t{7}) == sum + 7);
+    CHECK(reduce(par(3), v.begin(), v.end(), std::int64_t{0}) == sum);
+    CHECK(reduce(par, v, std::int64_t{0}) == sum);
+    CHECK(reduce(par(4), v | view::take(10), std::int64_t{0}) == 45);
+    CHECK(reduce(par(4), v.begin(), v.begin(), std::int64_t{3}) == 3);
+    CHECK(transform_reduce(par(4), v, std::int64_t{0}, plus{},
+        [](std::int64_t i) { return i % 3; }) == 300000);
+
+    // Projections, and a forward range that must be walked to find each piece.
+    std::vector<S> s(100000, S{2});
+    CHECK(reduce(par(4), s, 0, plus{}, &S::i) == 200000);
+    CHECK(transform_reduce(par(4), s, 0, plus{}, [](int i) { return i * 3; }, &S::i) == 600000);
+    std::list<int> l(v.begin(), v.begin() + 100000);
+    CHECK(reduce(par(4), l, std::int64_t{0}) == 99999ll * 100000 / 2);
+
+    // An associative op that does not commute: the order is kept.
+    auto letter = [](int i) { return std::string(1, static_cast<char>('a' + i % 26)); };
+    std::string expected;
+    for(int i = 0; i < 100000; ++i)
+        expected += letter(i);
+    CHECK(reduce(par(4), view::iota(0) | view::take(100000), std::string{">"}, plus{}, letter) ==
+        ">" + expected);
+
+    // An exception thrown on another thread reaches the caller.
+    bool thrown = false;
+    try
+    {
+        reduce(par(4), v, std::int64_t{0}, [](std::int64_t a, std::int64_t b)
+        {
+            if(b == 250000)
+                throw std::runtime_error("reduce");
+            return a + b;
+        });
+    }
+    catch(std::runtime_error const &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return ::test_result();
+}
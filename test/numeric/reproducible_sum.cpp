@@ -0,0 +1,72 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/reproducible_sum.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    float f;
+};
+
+template<typename T>
+bool same_bits(T a, T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    CHECK(reproducible_sum({1.0, 2.0, 3.5}) == 6.5);
+    CHECK(reproducible_sum(std::vector<double>{}) == 0.0);
+    CHECK(reproducible_sum({1, 2, 3}) == 6);
+    CHECK(reproducible_sum({S{1.5f}, S{2.5f}}, &S::f) == 4.0f);
+
+    // Values of wildly different magnitudes, so that the result depends on the
+    // order of the additions. Lengths that end in a partial block, and block
+    // counts that are and aren't powers of two.
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> mantissa{-1.0, 1.0};
+    std::uniform_int_distribution<int> exponent{-30, 30};
+    std::vector<double> v(1 << 20);
+    for(double &d : v)
+        d = std::ldexp(mantissa(gen), exponent(gen));
+    for(std::size_t n : {std::size_t(7), std::size_t(1024), std::size_t(1025),
+        std::size_t(64 * 1024), std::size_t(100000), v.size()})
+    {
+        auto const rng = make_range(v.begin(), v.begin() + n);
+        double const sum = reproducible_sum(rng);
+        for(unsigned t = 1; t <= 8; ++t)
+            CHECK(same_bits(reproducible_sum(par(t), rng), sum));
+        CHECK(same_bits(reproducible_sum(par, v.begin(), v.begin() + n), sum));
+        // Read one element at a time, the tree is built as the blocks go by.
+        auto const in = make_range(input_iterator<double const *>(v.data()),
+            sentinel<double const *>(v.data() + n));
+        CHECK(same_bits(reproducible_sum(in), sum));
+        // Close to the exact sum.
+        long double exact = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            exact += v[i];
+        CHECK(std::fabs(sum - static_cast<double>(exact)) <=
+            1e-12 * std::fabs(static_cast<double>(exact)) + 1e-3);
+    }
+
+    return ::test_result();
+}
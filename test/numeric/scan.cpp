@@ -0,0 +1,207 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/scan.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+struct affine
+{
+    std::uint32_t a, b;
+    friend bool operator==(affine const &x, affine const &y)
+    {
+        return x.a == y.a && x.b == y.b;
+    }
+};
+
+// Every length up to a few vectors, so that the kernels' scalar tails are covered,
+// in place and not.
+template<typename T>
+void test_kernels()
+{
+    using namespace ranges;
+    for(std::size_t n = 0; n < 40; ++n)
+    {
+        std::vector<T> v(n);
+        for(std::size_t i = 0; i < n; ++i)
+            v[i] = static_cast<T>(i * 3 % 7) - 2;
+        std::vector<T> incl(n), excl(n);
+        T sum = 5;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            excl[i] = sum;
+            sum = static_cast<T>(sum + v[i]);
+            incl[i] = static_cast<T>(sum - 5);
+        }
+        std::vector<T> out(n);
+        auto r = inclusive_scan(v, out.begin());
+        CHECK(r.first == v.end());
+        CHECK(r.second == out.end());
+        CHECK(out == incl);
+        auto s = exclusive_scan(v, out.begin(), T(5));
+        CHECK(s.second == out.end());
+        CHECK(out == excl);
+        std::vector<T> w = v;
+        inclusive_scan(w, w.begin());
+        CHECK(w == incl);
+        w = v;
+        exclusive_scan(w, w.begin(), T(5));
+        CHECK(w == excl);
+    }
+}
+
+// Enough elements for several threads and several rounds, with the last round
+// ragged.
+template<typename T>
+void test_parallel(std::size_t n)
+{
+    using namespace ranges;
+    std::vector<T> v(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = static_cast<T>(i % 5);
+    std::vector<T> incl(n), excl(n);
+    std::partial_sum(v.begin(), v.end(), incl.begin());
+    excl[0] = 1;
+    for(std::size_t i = 1; i < n; ++i)
+        excl[i] = static_cast<T>(incl[i - 1] + 1);
+
+    for(unsigned threads : {1u, 2u, 3u, 4u, 7u})
+    {
+        std::vector<T> out(n);
+        auto r = inclusive_scan(par(threads), v, out.begin());
+        CHECK(r.first == v.end());
+        CHECK(r.second == out.end());
+        CHECK(out == incl);
+        exclusive_scan(par(threads), v.begin(), v.end(), out.begin(), T(1));
+        CHECK(out == excl);
+        std::vector<T> w = v;
+        inclusive_scan(par(threads), w.begin(), w.end(), w.begin());
+        CHECK(w == incl);
+        w = v;
+        exclusive_scan(par(threads), w, w.begin(), T(1));
+        CHECK(w == excl);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Sequential, as partial_sum, over all kinds of iterators.
+    {
+        int ia[] = {1, 2, 3, 4, 5};
+        int ib[5] = {0};
+        auto r = inclusive_scan(input_iterator<int const *>(ia),
+            sentinel<int const *>(ia + 5), output_iterator<int *>(ib));
+        CHECK(base(r.first) == ia + 5);
+        CHECK(base(r.second) == ib + 5);
+        ::check_equal(ib, {1, 3, 6, 10, 15});
+        auto s = exclusive_scan(input_iterator<int const *>(ia),
+            sentinel<int const *>(ia + 5), output_iterator<int *>(ib), 10);
+        CHECK(base(s.first) == ia + 5);
+        CHECK(base(s.second) == ib + 5);
+        ::check_equal(ib, {10, 11, 13, 16, 20});
+        std::list<int> l(ia, ia + 5);
+        exclusive_scan(l, ib + 0, 0, multiplies{});
+        ::check_equal(ib, {0, 0, 0, 0, 0});
+        exclusive_scan(l, ib + 0, 1, multiplies{});
+        ::check_equal(ib, {1, 1, 2, 6, 24});
+        S sa[] = {{1}, {2}, {3}};
+        inclusive_scan(sa, ib + 0, plus{}, &S::i);
+        ::check_equal(ib, {1, 3, 6, 6, 24});
+    }
+
+    // A different type from the elements.
+    {
+        std::vector<int> v = {3, 1, 4};
+        std::vector<std::int64_t> out(3);
+        exclusive_scan(v, out.begin(), std::int64_t{1} << 40);
+        ::check_equal(out, {(1ll << 40), (1ll << 40) + 3, (1ll << 40) + 4});
+    }
+
+    test_kernels<int>();
+    test_kernels<unsigned>();
+    test_kernels<std::int64_t>();
+    test_kernels<std::uint64_t>();
+
+    test_parallel<std::int64_t>(1000003);
+    test_parallel<unsigned>(300001);
+    test_parallel<double>(200000);
+
+    // Projections, and an associative op that does not commute.
+    {
+        std::vector<S> s(200000, S{2});
+        std::vector<int> out(s.size());
+        inclusive_scan(par(4), s, out.begin(), plus{}, &S::i);
+        CHECK(out.front() == 2);
+        CHECK(out[99999] == 200000);
+        CHECK(out.back() == 400000);
+
+        // x -> a * x + b, composed left to right.
+        auto then = [](affine f, affine g) { return affine{g.a * f.a, g.a * f.b + g.b}; };
+        auto map = [](int i) { return affine{std::uint32_t(i % 7 + 2), std::uint32_t(i)}; };
+        auto maps = view::iota(0) | view::take(150000);
+        std::vector<affine> got(150000), expected(150000);
+        exclusive_scan(par(4), maps, got.begin(), affine{1, 0}, then, map);
+        exclusive_scan(maps, expected.begin(), affine{1, 0}, then, map);
+        CHECK(got == expected);
+        CHECK(!(then(map(1), map(2)) == then(map(2), map(1))));
+    }
+
+    // Small inputs stay on the calling thread.
+    {
+        std::vector<int> v = {1, 2, 3};
+        std::vector<int> out(3);
+        inclusive_scan(par(8), v, out.begin());
+        ::check_equal(out, {1, 3, 6});
+        std::vector<int> e;
+        CHECK(inclusive_scan(par(8), e, out.begin()).second == out.begin());
+        CHECK(exclusive_scan(par(8), e, out.begin(), 0).second == out.begin());
+    }
+
+    // An exception thrown on another thread reaches the caller.
+    {
+        std::vector<std::int64_t> v(500000, 1);
+        std::vector<std::int64_t> out(v.size());
+        bool thrown = false;
+        try
+        {
+            inclusive_scan(par(4), v, out.begin(), [](std::int64_t a, std::int64_t b)
+            {
+                if(a == 400000)
+                    throw std::runtime_error("scan");
+                return a + b;
+            });
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    return ::test_result();
+}
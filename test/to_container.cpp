@@ -15,9 +15,12 @@
 #include <range/v3/to_container.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/transform.hpp>
+#include <range/v3/view/counted.hpp>
+#include <range/v3/view/take_while.hpp>
 #include <range/v3/action/sort.hpp>
 #include "./simple_test.hpp"
 #include "./test_utils.hpp"
+#include "./test_iterators.hpp"
 
 int main()
 {
@@ -38,5 +41,32 @@ int main()
     static_assert((bool)Same<decltype(vec1), std::vector<long>>(), "");
     ::check_equal(vec1, {81,64,49,36,25,16,9,4,1,0});
 
+    // Sized input range: reserved exactly once
+    {
+        int rgi[] = {0,1,2,3,4,5,6,7,8,9};
+        auto rng = view::counted(::input_iterator<int const *>(rgi), 10)
+            | view::transform([](int i){return i*2;});
+        CONCEPT_ASSERT(SizedIterable<decltype(rng)>());
+        auto vec2 = rng | to_vector;
+        static_assert((bool)Same<decltype(vec2), std::vector<int>>(), "");
+        CHECK(vec2.capacity() == 10u);
+        ::check_equal(vec2, {0,2,4,6,8,10,12,14,16,18});
+    }
+
+    // Unsized input range: grown in chunks
+    {
+        std::vector<int> big(5000);
+        for(int i = 0; i < 5000; ++i)
+            big[i] = i;
+        auto rng = view::counted(::input_iterator<int const *>(big.data()), 5000)
+            | view::take_while([](int i){return i < 4000;});
+        CONCEPT_ASSERT(!SizedIterable<decltype(rng)>());
+        CONCEPT_ASSERT(!ForwardIterable<decltype(rng)>());
+        auto vec3 = rng | to_vector;
+        CHECK(vec3.size() == 4000u);
+        CHECK(vec3.front() == 0);
+        CHECK(vec3.back() == 3999);
+    }
+
     return ::test_result();
 }
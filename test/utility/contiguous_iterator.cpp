@@ -0,0 +1,189 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <array>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/contiguous_iterator.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/copy_backward.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/slice.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+enum class color : short { red, green, blue };
+
+int main()
+{
+    using namespace ranges;
+
+    // The trait
+    static_assert(is_contiguous_iterator<int *>(), "");
+    static_assert(is_contiguous_iterator<int const *>(), "");
+    static_assert(is_contiguous_iterator<std::vector<int>::iterator>(), "");
+    static_assert(is_contiguous_iterator<std::vector<int>::const_iterator>(), "");
+    static_assert(!is_contiguous_iterator<std::vector<bool>::iterator>(), "");
+    static_assert(is_contiguous_iterator<std::string::iterator>(), "");
+    static_assert(is_contiguous_iterator<std::wstring::const_iterator>(), "");
+    static_assert(is_contiguous_iterator<std::array<double, 4>::iterator>(), "");
+    static_assert(!is_contiguous_iterator<std::list<int>::iterator>(), "");
+    static_assert(!is_contiguous_iterator<std::reverse_iterator<int *>>(), "");
+    static_assert(!is_contiguous_iterator<random_access_iterator<int *>>(), "");
+    static_assert(!is_contiguous_iterator<int>(), "");
+
+    // Views that keep the underlying iterators stay contiguous.
+    std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    static_assert(is_contiguous_iterator<range_iterator_t<decltype(view::all(v))>>(), "");
+    static_assert(is_contiguous_iterator<range_iterator_t<decltype(v | view::take(3))>>(), "");
+    static_assert(is_contiguous_iterator<range_iterator_t<decltype(v | view::slice(2, 5))>>(), "");
+    static_assert(!is_contiguous_iterator<range_iterator_t<decltype(v | view::reverse)>>(), "");
+
+    // as_contiguous_range
+    {
+        auto rng = as_contiguous_range(v.begin() + 2, v.begin() + 5);
+        CHECK(rng.begin() == v.data() + 2);
+        CHECK(rng.end() == v.data() + 5);
+        ::check_equal(rng, {2, 3, 4});
+        ::models<concepts::SizedIterable>(rng);
+
+        std::vector<int> const &cv = v;
+        range<int const *> crng = as_contiguous_range(cv.begin(), cv.end());
+        CHECK(crng.size() == 10u);
+
+        std::vector<int> empty;
+        auto erng = as_contiguous_range(empty.begin(), empty.end());
+        CHECK(erng.begin() == nullptr);
+        CHECK(erng.end() == nullptr);
+    }
+
+    // copy, move and copy_backward
+    {
+        std::vector<int> out(10, -1);
+        auto first4 = v | view::take(4);
+        auto res = copy(first4, out.begin() + 1);
+        CHECK(res.first == v.begin() + 4);
+        CHECK(res.second == out.begin() + 5);
+        ::check_equal(out, {-1, 0, 1, 2, 3, -1, -1, -1, -1, -1});
+
+        auto mid = v | view::slice(6, 9);
+        auto mres = move(mid, out.begin());
+        CHECK(mres.first == v.begin() + 9);
+        CHECK(mres.second == out.begin() + 3);
+        ::check_equal(out, {6, 7, 8, 2, 3, -1, -1, -1, -1, -1});
+
+        // Overlapping, to the right.
+        auto bres = copy_backward(out.begin(), out.begin() + 5, out.begin() + 7);
+        CHECK(bres.first == out.begin() + 5);
+        CHECK(bres.second == out.begin() + 2);
+        ::check_equal(out, {6, 7, 6, 7, 8, 2, 3, -1, -1, -1});
+
+        // Overlapping, to the left.
+        copy(out.begin() + 2, out.begin() + 7, out.begin());
+        ::check_equal(out, {6, 7, 8, 2, 3, 2, 3, -1, -1, -1});
+
+        // Empty ranges touch nothing.
+        std::vector<int> none;
+        auto eres = copy(none, none.begin());
+        CHECK(eres.first == none.end());
+        CHECK(eres.second == none.begin());
+        CHECK(copy_backward(none, none.end()).second == none.end());
+
+        // A projection still goes element by element.
+        int arr[3] = {};
+        copy(first4.begin(), first4.begin() + 3, arr, [](int i) { return i * 10; });
+        ::check_equal(arr, {0, 10, 20});
+
+        // Between pointers and vector iterators, in both directions.
+        int const src[] = {5, 6, 7};
+        copy(src, out.begin());
+        copy(out.begin(), out.begin() + 3, arr);
+        ::check_equal(arr, {5, 6, 7});
+    }
+
+    // fill
+    {
+        std::string s(8, 'x');
+        auto mid = s | view::slice(2, 5);
+        CHECK(fill(mid, 'y') == s.begin() + 5);
+        CHECK(s == "xxyyyxxx");
+        fill(s.begin(), s.end(), 'a' + 1);
+        CHECK(s == "bbbbbbbb");
+        signed char sc[4] = {};
+        fill(sc, -3);
+        ::check_equal(sc, {-3, -3, -3, -3});
+        std::vector<int> iv(3);
+        fill(iv, 257);
+        ::check_equal(iv, {257, 257, 257});
+        std::vector<char> empty;
+        CHECK(fill(empty, 'z') == empty.end());
+    }
+
+    // find
+    {
+        std::string const s = "hello, world";
+        CHECK(find(s, 'w') == s.begin() + 7);
+        CHECK(find(s, 'q') == s.end());
+        auto hello = s | view::take(5);
+        auto mid = s | view::slice(3, 10);
+        CHECK(find(hello, 'w') == s.begin() + 5);
+        CHECK(find(mid, 'o') == s.begin() + 4);
+        // The value is compared after the usual arithmetic conversions.
+        CHECK(find(s, 'w' + 256) == s.end());
+        CHECK(find(s, (int)'w') == s.begin() + 7);
+        unsigned char const uc[] = {1, 255, 3};
+        CHECK(find(uc, 255) == uc + 1);
+        CHECK(find(uc, -1) == uc + 3);
+        signed char const scs[] = {1, -1, 3};
+        CHECK(find(scs, -1) == scs + 1);
+        CHECK(find(scs, 255) == scs + 3);
+        std::string empty;
+        CHECK(find(empty, 'a') == empty.end());
+    }
+
+    // equal
+    {
+        std::vector<int> w = v;
+        CHECK(equal(v, w));
+        CHECK(equal(v.begin(), v.end(), w.begin()));
+        CHECK(equal(v | view::take(5), w | view::slice(0, 5)));
+        CHECK(!equal(v | view::take(5), w | view::slice(1, 6)));
+        CHECK(!equal(v | view::take(5), w | view::take(6)));
+        w[9] = 42;
+        CHECK(!equal(v, w));
+        CHECK(!equal(v.begin(), v.end(), w.begin()));
+        CHECK(equal(v.begin(), v.end() - 1, w.begin()));
+
+        std::vector<color> c0{color::red, color::blue}, c1{color::red, color::blue};
+        CHECK(equal(c0, c1));
+        c1[1] = color::green;
+        CHECK(!equal(c0, c1));
+
+        // Floating point compares by value: -0.0 == 0.0.
+        std::vector<double> d0{0.0, 1.0}, d1{-0.0, 1.0};
+        CHECK(equal(d0, d1));
+
+        std::vector<int> e0, e1;
+        CHECK(equal(e0, e1));
+        CHECK(equal(e0.begin(), e0.end(), e1.begin()));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,125 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/dfa_pattern.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+bool full(char const *pattern, std::string const &s)
+{
+    return ranges::dfa_pattern{pattern}.full_match(s.begin(), s.end());
+}
+
+std::size_t longest(char const *pattern, std::string const &s)
+{
+    return static_cast<std::size_t>(
+        ranges::dfa_pattern{pattern}.match(s.begin(), s.end()) - s.begin());
+}
+
+bool throws(char const *pattern)
+{
+    try
+    {
+        ranges::dfa_pattern{pattern};
+    }
+    catch(std::invalid_argument const &)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Literals, concatenation and alternation.
+    CHECK(full("abc", "abc"));
+    CHECK(!full("abc", "ab"));
+    CHECK(!full("abc", "abcd"));
+    CHECK(full("ab|cd", "cd"));
+    CHECK(!full("ab|cd", "ad"));
+    CHECK(full("a(b|c)d", "acd"));
+    CHECK(full("a(?:b|c)d", "abd"));
+    CHECK(full("", ""));
+    CHECK(full("a|", ""));
+
+    // Repetition.
+    CHECK(full("a*", ""));
+    CHECK(full("a*", "aaaa"));
+    CHECK(!full("a+", ""));
+    CHECK(full("a+b", "aaab"));
+    CHECK(full("ab?c", "ac"));
+    CHECK(full("ab?c", "abc"));
+    CHECK(full("(ab)+", "ababab"));
+    CHECK(!full("(ab)+", "aba"));
+    CHECK(full("a{3}", "aaa"));
+    CHECK(!full("a{3}", "aa"));
+    CHECK(full("a{2,}", "aaaaa"));
+    CHECK(!full("a{2,}", "a"));
+    CHECK(full("a{1,3}", "aaa"));
+    CHECK(!full("a{1,3}", "aaaa"));
+    CHECK(full("(a|b){0,2}c", "bac"));
+    CHECK(full("x{0}y", "y"));
+
+    // Character classes and escapes.
+    CHECK(full("[a-c]+", "abcabc"));
+    CHECK(!full("[a-c]", "d"));
+    CHECK(full("[^a-c]", "d"));
+    CHECK(!full("[^a-c]", "b"));
+    CHECK(full("[-a]", "-"));
+    CHECK(full("[a-]", "-"));
+    CHECK(full("[]]", "") == false);
+    CHECK(full("[\\]x]", "]"));
+    CHECK(full("\\d+\\.\\d+", "3.14"));
+    CHECK(full("\\w+", "snake_case42"));
+    CHECK(!full("\\w", "-"));
+    CHECK(full("\\s\\S", "\tx"));
+    CHECK(full("[\\d_]+", "1_2"));
+    CHECK(full("\\x41\\n", "A\n"));
+    CHECK(full(".", "x"));
+    CHECK(!full(".", "\n"));
+    CHECK(full("[\\x00-\\xff]", std::string(1, '\xe9')));
+
+    // Longest match.
+    CHECK(longest("[a-z]+", "hello world") == 5u);
+    CHECK(longest("a|ab|abc", "abcd") == 3u);
+    CHECK(longest("ab|abcd", "abcx") == 2u);
+    CHECK(longest("x", "abc") == 0u);
+    CHECK(longest("a*", "bbb") == 0u);
+    CHECK(longest("[0-9]+(\\.[0-9]+)?", "12.5e3") == 4u);
+    CHECK(longest("[0-9]+(\\.[0-9]+)?", "12.e3") == 2u);
+
+    dfa_pattern const word{"[a-z]+"};
+    CHECK(word.can_start('q'));
+    CHECK(!word.can_start('Q'));
+    CHECK(word.state_count() == 3u);
+
+    // Errors.
+    CHECK(throws("("));
+    CHECK(throws("a)"));
+    CHECK(throws("[abc"));
+    CHECK(throws("*a"));
+    CHECK(throws("a{2,1}"));
+    CHECK(throws("a{x}"));
+    CHECK(throws("[z-a]"));
+    CHECK(throws("^a"));
+    CHECK(throws("a\\"));
+    CHECK(throws("\\q"));
+    CHECK(throws("\\xg0"));
+    CHECK(!throws("a{1000}"));
+    CHECK(throws("a{1001}"));
+
+    return ::test_result();
+}
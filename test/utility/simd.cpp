@@ -0,0 +1,245 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <limits>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/simd.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/mismatch.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/slice.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+// Every length up to a few vectors, with the interesting element at every
+// position, so that both the vector loop and the scalar tail are covered.
+template<typename T>
+void test_algorithms()
+{
+    using namespace ranges;
+    for(std::size_t n = 0; n < 80; ++n)
+    {
+        std::vector<T> v(n, T(1));
+        CHECK(find(v, T(2)) == v.end());
+        CHECK(count(v, T(1)) == static_cast<std::ptrdiff_t>(n));
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            std::vector<T> w = v;
+            w[i] = T(2);
+            CHECK(find(w, T(2)) == w.begin() + i);
+            CHECK(count(w, T(2)) == 1);
+            CHECK(count(w, T(1)) == static_cast<std::ptrdiff_t>(n - 1));
+            auto p = mismatch(v, w);
+            CHECK(p.first == v.begin() + i);
+            CHECK(p.second == w.begin() + i);
+            CHECK(!equal(v, w));
+            CHECK(!equal(v.begin(), v.end(), w.begin()));
+            w[i] = T(1);
+            CHECK(equal(v, w));
+        }
+        auto p = mismatch(v, v);
+        CHECK(p.first == v.end());
+    }
+
+    // Through views, and with ranges of different lengths.
+    std::vector<T> v(100);
+    for(std::size_t i = 0; i < v.size(); ++i)
+        v[i] = T(i % 7);
+    auto front = v | view::take(50);
+    auto back = v | view::slice(7, 100);
+    CHECK(find(front, T(6)) == v.begin() + 6);
+    CHECK(count(front, T(0)) == 8);
+    CHECK(count(back, T(0)) == 14);
+    auto p = mismatch(front, back);
+    CHECK(p.first == v.begin() + 50);
+    CHECK(p.second == v.begin() + 57);
+    auto q = mismatch(back, front);
+    CHECK(q.first == v.begin() + 57);
+    CHECK(q.second == v.begin() + 50);
+    CHECK(equal(front, v | view::slice(7, 57)));
+}
+
+template<typename T>
+void test_floating_point()
+{
+    using namespace ranges;
+    T const nan = std::numeric_limits<T>::quiet_NaN();
+    std::vector<T> v(40, T(1));
+    v[3] = T(-0.0);
+    v[17] = nan;
+    CHECK(find(v, T(0)) == v.begin() + 3);
+    CHECK(count(v, T(0.0)) == 1);
+    CHECK(find(v, nan) == v.end());
+    CHECK(count(v, nan) == 0);
+    std::vector<T> w = v;
+    w[3] = T(0);
+    // -0.0 == 0.0, but NaN != NaN.
+    CHECK(mismatch(v, w).first == v.begin() + 17);
+    CHECK(!equal(v, w));
+    v[17] = w[17] = T(2);
+    CHECK(equal(v, w));
+}
+
+int main()
+{
+    using namespace ranges;
+
+    test_algorithms<char>();
+    test_algorithms<signed char>();
+    test_algorithms<unsigned char>();
+    test_algorithms<short>();
+    test_algorithms<std::uint16_t>();
+    test_algorithms<int>();
+    test_algorithms<unsigned>();
+    test_algorithms<std::int64_t>();
+    test_algorithms<std::uint64_t>();
+    test_algorithms<float>();
+    test_algorithms<double>();
+    test_floating_point<float>();
+    test_floating_point<double>();
+
+    // 64-bit values that differ in only one of their 32-bit halves.
+    {
+        std::vector<std::int64_t> v(20, 0x100000001ll);
+        v[9] = 0x100000002ll;
+        v[13] = 0x200000001ll;
+        CHECK(find(v, 0x100000002ll) == v.begin() + 9);
+        CHECK(find(v, 0x200000001ll) == v.begin() + 13);
+        CHECK(count(v, 0x100000001ll) == 18);
+        CHECK(find(v, 1) == v.end());
+    }
+
+    // The value is compared after the usual arithmetic conversions.
+    {
+        std::vector<short> v{1, -1, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        CHECK(find(v, -1) == v.begin() + 1);
+        CHECK(find(v, 65535) == v.end());
+        CHECK(count(v, 65535u) == 0);
+        CHECK(count(v, -1l) == 1);
+        std::vector<unsigned> u(20, 7u);
+        CHECK(count(u, 7ll) == 20);
+        CHECK(count(u, 7ll + (1ll << 32)) == 0);
+        CHECK(find(u, -1) == u.end());
+        u[5] = 0xffffffffu;
+        CHECK(find(u, -1) == u.begin() + 5);
+    }
+
+    // Anything else stays on the scalar path.
+    {
+        std::vector<int> v{1, 2, 3, 4};
+        CHECK(find(v, 3, [](int i) { return i + 1; }) == v.begin() + 1);
+        CHECK(count(v, 2.0) == 1);
+        std::vector<int> w{1, 2, 3, 5};
+        CHECK(mismatch(v, w, [](int a, int b) { return a / 2 == b / 2; }).first == v.end());
+    }
+
+#if RANGES_HAVE_X86_SIMD
+    // Both instruction sets, whichever one the dispatcher picks.
+    {
+        std::vector<int> v(1000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>(i % 10);
+        std::vector<int> w = v;
+        w[997] = -1;
+        using namespace detail::simd;
+        CHECK(sse2_kernels::find(v.data(), v.size(), 9) == 9u);
+        CHECK(sse2_kernels::count(v.data(), v.size(), 3) == 100u);
+        CHECK(sse2_kernels::mismatch(v.data(), w.data(), v.size()) == 997u);
+        if(has_avx2())
+        {
+            CHECK(avx2_kernels::find(v.data(), v.size(), 9) == 9u);
+            CHECK(avx2_kernels::count(v.data(), v.size(), 3) == 100u);
+            CHECK(avx2_kernels::mismatch(v.data(), w.data(), v.size()) == 997u);
+        }
+
+        // Values whose sums and products are exact, in any order.
+        std::vector<double> d(1003);
+        std::vector<float> f(1003);
+        for(std::size_t i = 0; i < d.size(); ++i)
+        {
+            d[i] = static_cast<double>(i % 10);
+            f[i] = i % 100 == 7 ? 2.0f : (i % 100 == 8 ? 0.5f : 1.0f);
+        }
+        CHECK(sse2_fp_kernels::sum(d.data(), d.size()) == 4503.0);
+        CHECK(sse2_fp_kernels::product(f.data(), f.size()) == 1.0f);
+        CHECK(sse2_fp_kernels::dot(d.data(), d.data(), d.size()) == 28505.0);
+        CHECK(sse2_fp_kernels::dot(f.data(), f.data(), 9) == 11.25f);
+        if(has_avx2_fma())
+        {
+            CHECK(avx2_fp_kernels::sum(d.data(), d.size()) == 4503.0);
+            CHECK(avx2_fp_kernels::product(f.data(), f.size()) == 1.0f);
+            CHECK(avx2_fp_kernels::dot(d.data(), d.data(), d.size()) == 28505.0);
+            CHECK(avx2_fp_kernels::dot(f.data(), f.data(), 9) == 11.25f);
+        }
+
+        // Running sums, in place and not, with scalar tails.
+        std::vector<int> incl(v.size()), excl(v.size()), out(v.size());
+        std::vector<std::int64_t> l(v.begin(), v.end()), lincl(v.size());
+        int sum = 3;
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            excl[i] = sum;
+            sum += v[i];
+            incl[i] = sum;
+            lincl[i] = sum;
+        }
+        CHECK(sse2_kernels::scan<false>(v.data(), out.data(), v.size(), 3) == sum);
+        CHECK(out == incl);
+        CHECK(sse2_kernels::scan<true>(v.data(), out.data(), v.size(), 3) == sum);
+        CHECK(out == excl);
+        CHECK(sse2_kernels::scan<false>(l.data(), l.data(), l.size(), std::int64_t{3}) == sum);
+        CHECK(l == lincl);
+        if(has_avx2())
+        {
+            CHECK(avx2_kernels::scan<false>(v.data(), out.data(), v.size(), 3) == sum);
+            CHECK(out == incl);
+            CHECK(avx2_kernels::scan<true>(v.data(), out.data(), v.size(), 3) == sum);
+            CHECK(out == excl);
+            l.assign(v.begin(), v.end());
+            CHECK(avx2_kernels::scan<false>(l.data(), l.data(), l.size(), std::int64_t{3}) ==
+                sum);
+            CHECK(l == lincl);
+        }
+
+        // Differences, undoing the running sums.
+        sse2_kernels::difference(incl.data(), out.data(), incl.size(), 3);
+        CHECK(out == v);
+        sse2_kernels::difference(lincl.data(), lincl.data(), lincl.size(), std::int64_t{3});
+        CHECK(std::equal(lincl.begin(), lincl.end(), v.begin()));
+        sse2_kernels::difference(d.data(), d.data(), d.size(), 0.0);
+        CHECK(d[0] == 0.0);
+        CHECK(d[1] == 1.0);
+        CHECK(d[10] == -9.0);
+        CHECK(d[1002] == 1.0);
+        if(has_avx2())
+        {
+            avx2_kernels::difference(incl.data(), out.data(), incl.size(), 3);
+            CHECK(out == v);
+            std::vector<int> e = excl;
+            avx2_kernels::difference(e.data(), e.data(), e.size(), 3);
+            CHECK(e[0] == 0);
+            CHECK(std::equal(e.begin() + 1, e.end(), v.begin()));
+            avx2_kernels::difference(f.data(), f.data(), f.size(), 1.0f);
+            CHECK(f[0] == 0.0f);
+            CHECK(f[7] == 1.0f);
+            CHECK(f[8] == -1.5f);
+            CHECK(f[9] == 0.5f);
+        }
+    }
+#endif
+
+    return ::test_result();
+}
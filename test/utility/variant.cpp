@@ -0,0 +1,81 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <range/v3/utility/variant.hpp>
+#include "../simple_test.hpp"
+
+using namespace ranges;
+
+// Seven alternatives, so run-time dispatch has to split uneven intervals.
+using var_t = tagged_variant<int, std::string, long, std::string, char, std::string, double>;
+
+struct index_fn
+{
+    template<typename T, std::size_t N>
+    std::size_t operator()(T &, meta::size_t<N>) const
+    {
+        return N;
+    }
+};
+
+template<std::size_t N, typename T>
+void check_alternative(T const &t)
+{
+    var_t v{meta::size_t<N>{}, t};
+    CHECK(v.which() == N);
+    CHECK(get<N>(v) == t);
+    auto i = v.apply_i(index_fn{});
+    CHECK(i.which() == N);
+    CHECK(get<0>(unique_variant(i)) == N);
+
+    var_t c{v};
+    CHECK(c.which() == N);
+    CHECK(get<N>(c) == t);
+    CHECK(c == v);
+
+    var_t m{std::move(c)};
+    CHECK(m.which() == N);
+    CHECK(get<N>(m) == t);
+
+    var_t a;
+    a = m;
+    CHECK(a == m);
+    a = var_t{meta::size_t<0>{}, -1};
+    CHECK(a.which() == 0u);
+    CHECK(a != m);
+    a.set<N>(t);
+    CHECK(a.which() == N);
+    CHECK(a == m);
+}
+
+int main()
+{
+    check_alternative<0>(1);
+    check_alternative<1>(std::string("one"));
+    check_alternative<2>(2L);
+    check_alternative<3>(std::string("three, which is long enough not to fit in SSO"));
+    check_alternative<4>('4');
+    check_alternative<5>(std::string("five"));
+    check_alternative<6>(6.5);
+
+    {
+        // Same type at different indices is still distinguished by index.
+        var_t one{meta::size_t<1>{}, std::string("x")};
+        var_t three{meta::size_t<3>{}, std::string("x")};
+        CHECK(one != three);
+        auto u = unique_variant(three);
+        CHECK(u.which() == 1u);
+        CHECK(get<1>(u) == "x");
+    }
+
+    return test_result();
+}
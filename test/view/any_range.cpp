@@ -9,13 +9,27 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <list>
+#include <array>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/binary_search.hpp>
+#include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/view/any_range.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+std::array<int, 3> &buf_of_three()
+{
+    static std::array<int, 3> buf{};
+    return buf;
+}
+
 int main()
 {
     using namespace ranges;
@@ -26,5 +40,105 @@ int main()
     any_input_range<int> ints2 = view::ints | view::take(10);
     ::check_equal(ints2, {0,1,2,3,4,5,6,7,8,9});
 
+    // Copies and moves of ranges and iterators, stored inline and on the heap.
+    {
+        std::vector<int> v{0,1,2,3,4,5,6,7,8,9};
+        any_input_range<int &> small = v;
+        any_input_range<int &> small2 = small;
+        ::check_equal(small2, v);
+        any_input_range<int &> small3 = std::move(small);
+        ::check_equal(small3, v);
+
+        std::array<char, 256> padding{};
+        any_input_range<int> big = view::ints | view::take(10) |
+            view::transform([padding](int i) { return i + padding[0]; });
+        any_input_range<int> big2 = big;
+        ::check_equal(big2, {0,1,2,3,4,5,6,7,8,9});
+        any_input_range<int> big3 = std::move(big);
+        ::check_equal(big3, {0,1,2,3,4,5,6,7,8,9});
+
+        auto it = begin(small3);
+        ++it;
+        auto it2 = it;
+        CHECK(*it2 == 1);
+        ++it2;
+        CHECK(*it == 1);
+        CHECK(*it2 == 2);
+    }
+
+    // Batched reads and skips.
+    {
+        any_input_range<int> rng = view::ints | view::take(10);
+        auto it = begin(rng);
+        int buf[4] = {};
+        CHECK(it.read_into(buf, 4) == 4);
+        ::check_equal(buf, {0,1,2,3});
+        CHECK(*it == 4);
+        CHECK(it.next_n(3) == 3);
+        CHECK(*it == 7);
+        CHECK(it.read_into(buf, 4) == 3);
+        ::check_equal(buf | view::take(3), {7,8,9});
+        CHECK(it == end(rng));
+        CHECK(it.next_n(3) == 0);
+
+        any_input_range<int, true> inf = view::ints;
+        auto it3 = begin(inf);
+        CHECK(it3.next_n(1000) == 1000);
+        CHECK(*it3 == 1000);
+    }
+
+    // Multi-pass categories.
+    {
+        std::list<int> l{1,2,3,4};
+        any_forward_range<int &> fwd = l;
+        ::models<concepts::ForwardRange>(fwd);
+        ::models_not<concepts::BidirectionalRange>(fwd);
+        auto it = begin(fwd);
+        auto it2 = it;
+        ++it;
+        CHECK(*it2 == 1);
+        CHECK(*it == 2);
+        ::check_equal(fwd, {1,2,3,4});
+
+        any_bidirectional_range<int &> bidi = l;
+        ::models<concepts::BidirectionalRange>(bidi);
+        ::models<concepts::BoundedRange>(bidi);
+        ::models_not<concepts::RandomAccessRange>(bidi);
+        ::check_equal(bidi | view::reverse, {4,3,2,1});
+    }
+    {
+        std::vector<int> v{5,3,9,1,7,3};
+        any_random_access_range<int &> rng = v;
+        ::models<concepts::RandomAccessRange>(rng);
+        ::models<concepts::BoundedRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        CHECK(rng.size() == 6u);
+        CHECK(rng[2] == 9);
+        CHECK(rng.data() == v.data());
+
+        sort(rng);
+        ::check_equal(v, {1,3,3,5,7,9});
+        CHECK(binary_search(rng, 7));
+        CHECK(!binary_search(rng, 4));
+        auto eq = equal_range(rng, 3);
+        CHECK((eq.second - eq.first) == 2);
+        CHECK((eq.first - begin(rng)) == 1);
+
+        any_random_access_range<int> ints = view::ints(0, 9);
+        CHECK(ints.size() == 10u);
+        CHECK(ints.data() == nullptr);
+        ::check_equal(ints | view::reverse | view::take(3), {9,8,7});
+
+        int arr[] = {4,5,6};
+        any_random_access_range<int &> arr_rng = arr;
+        CHECK(arr_rng.data() == &arr[0]);
+        auto arr_it = begin(arr_rng);
+        CHECK(arr_it.read_into(buf_of_three().data(), 3) == 3);
+        CHECK(arr_it == end(arr_rng));
+
+        any_random_access_range<int, true> inf = view::ints;
+        CHECK(inf[100] == 100);
+    }
+
     return test_result();
 }
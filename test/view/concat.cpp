@@ -13,6 +13,10 @@
 #include <range/v3/core.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -66,5 +70,29 @@ int main()
     CHECK(*(end-=1) == "is");
     CHECK(*(end-=1) == "this");
 
+    // Algorithms walk a concatenation one range at a time.
+    {
+        std::vector<int> a{1, 2}, b{}, c{3, 4, 5};
+        auto rng = view::concat(a, b, c);
+        CHECK(detail::is_segmented<decltype(rng)>::value);
+        CHECK(accumulate(rng, 0) == 15);
+        CHECK(count(rng, 2) == 1);
+        CHECK((find(rng, 4) - rng.begin()) == 3);
+        CHECK(find(rng, 9) == rng.end());
+        auto one = view::concat(c);
+        CHECK(find(one, 5) == one.begin() + 2);
+        int out[5] = {};
+        auto res = copy(rng, out);
+        CHECK(res.first == rng.end());
+        CHECK(res.second == out + 5);
+        ::check_equal(out, {1, 2, 3, 4, 5});
+
+        // Ranges with different reference types are walked element by element.
+        std::vector<long> l{6, 7};
+        auto mixed = view::concat(a, l);
+        CHECK(!detail::is_segmented<decltype(mixed)>::value);
+        CHECK(accumulate(mixed, 0L) == 16L);
+    }
+
     return test_result();
 }
@@ -0,0 +1,93 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <sstream>
+#include <iterator>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/numeric/delta_encode.hpp>
+#include <range/v3/view/delta_decode.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+template<typename T>
+void test_round_trip()
+{
+    using namespace ranges;
+    // Step in the unsigned type, so that wrapping around is well-defined.
+    using U = meta::eval<std::make_unsigned<T>>;
+    std::vector<T> v(1000);
+    T t = static_cast<T>(std::numeric_limits<T>::min() + 3);
+    for(std::size_t i = 0; i < v.size(); ++i)
+    {
+        U const step = i % 5 == 0 ? static_cast<U>(U(0) - U(1000)) :
+            static_cast<U>((i % 17) << (i % 40));
+        v[i] = t = static_cast<T>(static_cast<U>(static_cast<U>(t) + step));
+    }
+    v.back() = std::numeric_limits<T>::max();
+    std::vector<std::uint8_t> b;
+    delta_encode(v, back_inserter(b));
+    CHECK(equal(view::delta_decode<T>(b), v));
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::uint8_t> b = {3, 1, 6, 127, 1};
+    auto ids = view::delta_decode<std::uint32_t>(b);
+    ::models<concepts::ForwardIterable>(ids);
+    ::models_not<concepts::BoundedIterable>(ids);
+    ::models<concepts::Range>(ids);
+    ::check_equal(ids, {3u, 4u, 10u, 137u, 138u});
+    CHECK(distance(ids) == 5);
+
+    // It composes with the other views, and pipes.
+    ::check_equal(b | view::delta_decode<std::uint32_t>() | view::take(2), {3u, 4u});
+    ::check_equal(ids | view::remove_if([](std::uint32_t i) { return i % 2 != 0; }) |
+        view::transform([](std::uint32_t i) { return i / 2; }), {2u, 5u, 69u});
+
+    // Nothing in, nothing out.
+    std::vector<std::uint8_t> none;
+    CHECK(begin(view::delta_decode<int>(none)) == end(view::delta_decode<int>(none)));
+
+    // Zigzagged signed differences, and bytes of another type.
+    std::vector<char> s = {0, 1, 2, 2, 127, char(0x80), 1};
+    ::check_equal(view::delta_decode<int>(s), {0, -1, 0, 1, -63, 1});
+
+    // A truncated varint ends the range with what was read.
+    std::vector<std::uint8_t> cut = {5, 0x82};
+    ::check_equal(view::delta_decode<unsigned>(cut), {5u, 7u});
+
+    // Bytes read from a stream, a single pass.
+    std::istringstream sin{std::string("\x03\x01\x06", 3)};
+    sin >> std::noskipws;
+    auto in = view::delta_decode<unsigned long>(istream<unsigned char>(sin));
+    ::models<concepts::InputIterable>(in);
+    ::models_not<concepts::ForwardIterable>(in);
+    ::check_equal(in, {3ul, 4ul, 10ul});
+
+    test_round_trip<std::int8_t>();
+    test_round_trip<std::uint16_t>();
+    test_round_trip<int>();
+    test_round_trip<unsigned>();
+    test_round_trip<std::int64_t>();
+    test_round_trip<std::uint64_t>();
+
+    return ::test_result();
+}
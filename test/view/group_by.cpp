@@ -11,7 +11,9 @@
 
 #include <list>
 #include <vector>
+#include <sstream>
 #include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/group_by.hpp>
 #include "../simple_test.hpp"
@@ -76,5 +78,55 @@ int main()
         check_equal(*next(rng1.begin()), {P{2,2},P{2,2},P{2,3},P{2,3},P{2,3},P{2,3}});
     }
 
+    // Every element of a group is compared with the group's first element, once.
+    {
+        std::vector<int> w{1, 2, 3, 4, 5, 6, 7};
+        int calls = 0;
+        auto rng = w | view::group_by([&](int a, int b) { ++calls; return b - a < 3; });
+        CHECK(distance(rng) == 3);
+        CHECK(calls == 6);
+        auto it = rng.begin();
+        ::has_type<range<std::vector<int>::iterator>>(*it);
+        CONCEPT_ASSERT(SizedIterable<decltype(*it)>());
+        CHECK((*it).size() == 3u);
+        check_equal(*it, {1, 2, 3});
+        check_equal(*++it, {4, 5, 6});
+        check_equal(*++it, {7});
+        CHECK(++it == rng.end());
+
+        std::vector<int> empty;
+        CHECK(distance(empty | view::group_by(std::equal_to<int>())) == 0);
+    }
+
+    // Over input ranges, groups read from the underlying range as they go.
+    {
+        std::istringstream sin{"1 1 2 3 3 3 4 4"};
+        auto ints = istream<int>(sin);
+        auto rng = ints | view::group_by(std::equal_to<int>());
+        CONCEPT_ASSERT(InputIterable<decltype(rng)>());
+        CONCEPT_ASSERT(!ForwardIterable<decltype(rng)>());
+        std::vector<int> firsts, sizes;
+        int i = 0;
+        RANGES_FOR(auto &&grp, rng)
+        {
+            // Leave the second group unread, and read only part of the third.
+            int n = 0;
+            if(i != 1)
+            {
+                RANGES_FOR(int j, grp)
+                {
+                    if(n == 0)
+                        firsts.push_back(j);
+                    if(++n == 2 && i == 2)
+                        break;
+                }
+            }
+            sizes.push_back(n);
+            ++i;
+        }
+        check_equal(firsts, {1, 3, 4});
+        check_equal(sizes, {2, 0, 2, 2});
+    }
+
     return test_result();
 }
@@ -16,6 +16,14 @@
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/generate_n.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -78,5 +86,64 @@ int main()
     CHECK(rng4.size() == 16u);
     CHECK(to_<std::string>(rng4) == "This is his face");
 
+    // Algorithms walk a join one inner range at a time.
+    {
+        std::vector<std::vector<int>> vvi{{1,2,3},{},{4},{},{5,6,7,8}};
+        auto rng5 = vvi | view::join;
+        CHECK(detail::is_segmented<decltype(rng5)>::value);
+        int sum = 0;
+        CHECK(for_each(rng5, [&](int i){ sum += i; }) == end(rng5));
+        CHECK(sum == 36);
+        CHECK(accumulate(rng5, 0) == 36);
+        CHECK(count(rng5, 4) == 1);
+        CHECK(count_if(rng5, [](int i){ return i % 2 == 0; }) == 4);
+        CHECK(find(rng5, 9) == end(rng5));
+        auto it = find(rng5, 3);
+        CHECK(*it == 3);
+        CHECK(*++it == 4);
+        CHECK(*++it == 5);
+        it = find_if(rng5, [](int i){ return i > 5; });
+        CHECK(*it == 6);
+        CHECK(std::distance(it, end(rng5)) == 3);
+        int out[8] = {};
+        auto res = copy(rng5, out);
+        CHECK(res.first == end(rng5));
+        CHECK(res.second == out + 8);
+        ::check_equal(out, {1,2,3,4,5,6,7,8});
+    }
+
+    // Joining true references keeps all the state in the iterator, so the join is
+    // multi-pass, bidirectional and const-iterable.
+    {
+        std::vector<std::vector<int>> const vvi{{1,2},{},{3},{},{4,5,6}};
+        auto rng7 = vvi | view::join;
+        models<concepts::BidirectionalIterable>(rng7);
+        models<concepts::BoundedIterable>(rng7);
+        models_not<concepts::RandomAccessIterable>(rng7);
+        auto const &crng7 = rng7;
+        models<concepts::BidirectionalIterable>(crng7);
+        check_equal(rng7, {1,2,3,4,5,6});
+        check_equal(rng7, {1,2,3,4,5,6});
+        check_equal(crng7, {1,2,3,4,5,6});
+        check_equal(rng7 | view::reverse, {6,5,4,3,2,1});
+        auto it = next(begin(rng7), 3);
+        auto it2 = it;
+        CHECK(*it == 4);
+        CHECK(*--it == 3);
+        CHECK(*++it2 == 5);
+        CHECK(*find(crng7, 5) == 5);
+        CHECK(accumulate(crng7, 0) == 21);
+
+        std::vector<std::vector<int>> empties(3);
+        auto rng8 = empties | view::join;
+        CHECK(begin(rng8) == end(rng8));
+        CHECK(accumulate(rng8, 0) == 0);
+    }
+
+    // ... including joins of input ranges.
+    N = 0;
+    auto rng6 = make_input_rng() | view::join;
+    CHECK(accumulate(rng6, 0) == 36);
+
     return ::test_result();
 }
@@ -9,6 +9,7 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <iterator>
 #include <functional>
 #include <range/v3/core.hpp>
@@ -78,5 +79,52 @@ int main()
     CONCEPT_ASSERT(Range<decltype(mutable_rng)>());
     CONCEPT_ASSERT(!Range<decltype(mutable_rng) const>());
 
+    // By default the predicate runs only on the elements the iterator reaches.
+    {
+        std::vector<int> w(1000);
+        for(int i = 0; i < 1000; ++i)
+            w[i] = i;
+        int calls = 0;
+        auto odd = w | view::remove_if([&calls](int i) { ++calls; return i % 2 != 0; });
+        auto wit = begin(odd);
+        CHECK(*++wit == 2);
+        CHECK(calls == 3);
+        calls = 0;
+        auto uodd = w | view::remove_if(unseq, [&calls](int i) { ++calls; return i % 2 != 0; });
+        CHECK(*++begin(uodd) == 2);
+        CHECK(calls >= 3);
+        CHECK(calls <= 64);
+    }
+
+    // With unseq, a random-access range of numbers long enough to be filtered 64
+    // elements at a time over several masks, with runs of kept and removed
+    // elements longer than a mask.
+    std::vector<int> v(1000);
+    for(int i = 0; i < 1000; ++i)
+        v[i] = (i * 7919) % 1000 < 500 || (i >= 300 && i < 450) ? i : -i;
+    v[999] = -1;
+    auto neg = [](int i) { return i < 0; };
+    std::vector<int> kept;
+    for(int i : v)
+        if(!neg(i))
+            kept.push_back(i);
+    auto vrng = v | view::remove_if(unseq, neg);
+    ::check_equal(v | view::remove_if(neg), kept);
+    ::check_equal(view::remove_if(v, unseq, neg), kept);
+    ::check_equal(vrng, kept);
+    ::check_equal(vrng | view::reverse, kept | view::reverse);
+    // Copies of an iterator step on their own.
+    auto it = next(begin(vrng), 100);
+    auto it2 = it;
+    CHECK(*it == kept[100]);
+    CHECK(*++it == kept[101]);
+    CHECK(*it2 == kept[100]);
+    CHECK(*++it2 == kept[101]);
+    CHECK(*--it == kept[100]);
+    CHECK(*++it == kept[101]);
+    CHECK(*++it == kept[102]);
+    ::check_equal(v | view::remove_if(unseq, [](int) { return true; }), std::vector<int>{});
+    ::check_equal(v | view::remove_if(unseq, [](int) { return false; }), v);
+
     return test_result();
 }
@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/split.hpp>
@@ -29,6 +30,23 @@ struct starts_with_g
     }
 };
 
+struct starts_with_sign
+{
+    template<typename I, typename S>
+    std::pair<bool, std::ptrdiff_t> operator()(I b, S) const
+    {
+        return {*b == '+' || *b == '-', 1};
+    }
+    template<typename I, typename S>
+    std::pair<I, std::ptrdiff_t> search(I b, S e) const
+    {
+        for(; b != e; ++b)
+            if((*this)(b, e).first)
+                return {b, 1};
+        return {b, 0};
+    }
+};
+
 template<std::size_t N>
 ranges::range<char const*> c_str(char const (&sz)[N])
 {
@@ -127,5 +145,116 @@ int main()
         }
     }
 
+    // Over a contiguous range, each piece is a range of pointers with a size.
+    {
+        std::string str("a,bc,,def,");
+        auto rng = view::split(str, ',');
+        using piece = range_value_t<decltype(rng)>;
+        CONCEPT_ASSERT(Same<piece, range<char *>>());
+        CHECK(distance(rng) == 4);
+        if(distance(rng) == 4)
+        {
+            auto it = begin(rng);
+            CHECK((*it).size() == 1u);
+            CHECK((*it).begin() == &str[0]);
+            check_equal(*it, c_str("a"));
+            check_equal(*++it, c_str("bc"));
+            CHECK((*++it).size() == 0u);
+            check_equal(*++it, c_str("def"));
+            CHECK((*it).end() == &str[9]);
+        }
+
+        std::string const cstr("Now is the time");
+        auto crng = view::split(cstr, c_str("is"));
+        CONCEPT_ASSERT(Same<range_value_t<decltype(crng)>, range<char const *>>());
+        CHECK(distance(crng) == 2);
+        check_equal(*begin(crng), c_str("Now "));
+        check_equal(*next(begin(crng)), c_str(" the time"));
+
+        auto grng = view::split(str, starts_with_g{});
+        CHECK(distance(grng) == 1);
+        check_equal(*begin(grng), c_str("a,bc,,def,"));
+
+        std::string meow("meow");
+        auto erng = view::split(meow, view::empty<char>());
+        CHECK(distance(erng) == 4);
+        check_equal(*next(begin(erng), 3), c_str("w"));
+
+        std::string empty;
+        CHECK(distance(view::split(empty, view::empty<char>())) == 0);
+
+        std::vector<int> v{1, 2, 0, 3, 0, 0, 4, 5, 6};
+        auto vrng = view::split(v, 0);
+        CHECK(distance(vrng) == 4);
+        if(distance(vrng) == 4)
+        {
+            check_equal(*begin(vrng), {1, 2});
+            check_equal(*next(begin(vrng), 1), {3});
+            CHECK((*next(begin(vrng), 2)).empty());
+            check_equal(*next(begin(vrng), 3), {4, 5, 6});
+        }
+    }
+
+    // Delimiter matchers with a search member skip ahead to the next match. Use
+    // inputs long enough to exercise the vectorized scans.
+    {
+        std::string str;
+        for(int i = 0; i < 100; ++i)
+            str += std::string(static_cast<std::size_t>(i % 37), 'x') + ',';
+        auto rng = view::split(str, ',');
+        CHECK(distance(rng) == 100);
+        int i = 0;
+        RANGES_FOR(auto piece, rng)
+        {
+            CHECK(piece.size() == static_cast<std::size_t>(i % 37));
+            ++i;
+        }
+
+        std::string crlf("aa\r\r\nbb\r\n\r\ncc\n\rdd");
+        auto lines = view::split(crlf, c_str("\r\n"));
+        CHECK(distance(lines) == 4);
+        if(distance(lines) == 4)
+        {
+            check_equal(*next(begin(lines), 0), c_str("aa\r"));
+            check_equal(*next(begin(lines), 1), c_str("bb"));
+            CHECK((*next(begin(lines), 2)).empty());
+            check_equal(*next(begin(lines), 3), c_str("cc\n\rdd"));
+        }
+
+        std::vector<int> v(200, 7);
+        v[5] = v[6] = v[150] = 42;
+        auto vrng = view::split(v, 42);
+        CHECK(distance(vrng) == 4);
+        if(distance(vrng) == 4)
+        {
+            CHECK((*next(begin(vrng), 0)).size() == 5u);
+            CHECK((*next(begin(vrng), 1)).size() == 0u);
+            CHECK((*next(begin(vrng), 2)).size() == 143u);
+            CHECK((*next(begin(vrng), 3)).size() == 49u);
+        }
+
+        // Non-contiguous ranges use the search member too.
+        forward_iterator<std::string::iterator> fi {crlf.begin()};
+        auto frng = view::counted(fi, crlf.size()) | view::split('\n');
+        CHECK(distance(frng) == 5);
+        if(distance(frng) == 5)
+        {
+            check_equal(*next(begin(frng), 0), c_str("aa\r\r"));
+            check_equal(*next(begin(frng), 3), c_str("cc"));
+        }
+    }
+
+    // A user-defined matcher can provide its own search.
+    {
+        std::string str("1+2-3+4");
+        auto rng = view::split(str, starts_with_sign{});
+        CHECK(distance(rng) == 4);
+        if(distance(rng) == 4)
+        {
+            check_equal(*begin(rng), c_str("1"));
+            check_equal(*next(begin(rng), 3), c_str("4"));
+        }
+    }
+
     return test_result();
 }
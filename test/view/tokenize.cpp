@@ -1,7 +1,22 @@
+#include <string>
+#include <vector>
+#include <sstream>
 #include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
 #include <range/v3/view/tokenize.hpp>
+#include <range/v3/view/counted.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+template<typename Rng>
+std::vector<std::string> strings(Rng &&rng)
+{
+	std::vector<std::string> v;
+	RANGES_FOR(auto &&tok, rng)
+		v.push_back(std::string(ranges::begin(tok), ranges::end(tok)));
+	return v;
+}
 
 int main()
 {
@@ -33,5 +48,47 @@ int main()
 	// ::models<concepts::Range>(rng);
 	// ::models<concepts::Range>(crng);
 
+	// The DFA backend yields pointer ranges over contiguous input.
+	{
+		dfa_pattern const word{"\\w+"};
+		auto&& drng = txt | view::tokenize(word);
+		::check_equal(strings(drng), {"abc","def","ghi"});
+		::has_type<range<char *>>(*ranges::begin(drng));
+		::models<concepts::ForwardIterable>(drng);
+		::models_not<concepts::BidirectionalIterable>(drng);
+		CHECK((*ranges::begin(drng)).size() == 3u);
+
+		std::string const csv{"x=12.5,y=-3,,z=7e2"};
+		auto nums = view::tokenize(csv, dfa_pattern{"-?[0-9]+(\\.[0-9]+)?(e[0-9]+)?"});
+		::check_equal(strings(nums), {"12.5","-3","7e2"});
+		::has_type<range<char const *>>(*ranges::begin(nums));
+
+		std::string dots{"..."}, none, as{"aa-a"}, ifs{"if iffy"};
+		CHECK(strings(dots | view::tokenize(word)).empty());
+		CHECK(strings(none | view::tokenize(word)).empty());
+		// Empty matches are skipped.
+		::check_equal(strings(as | view::tokenize(dfa_pattern{"a*"})), {"aa","a"});
+		// The longest match, not the first alternative.
+		::check_equal(strings(ifs | view::tokenize(dfa_pattern{"if|[a-z]+"})), {"if","iffy"});
+
+		// Over forward ranges, tokens are subranges of the input.
+		forward_iterator<std::string::iterator> i{txt.begin()};
+		auto frng = view::counted(i, txt.size()) | view::tokenize(word);
+		::check_equal(strings(frng), {"abc","def","ghi"});
+		::has_type<range<counted_iterator<forward_iterator<std::string::iterator>>>>(
+			*ranges::begin(frng));
+	}
+
+	// Over input ranges, tokens are buffered.
+	{
+		std::istringstream sin{"let x1 = 42;  y = x1+1 ; "};
+		sin >> std::noskipws;
+		auto chars = istream<char>(sin);
+		auto irng = chars | view::tokenize(dfa_pattern{"[a-z][a-z0-9]*|[0-9]+|[=+;]"});
+		::models<concepts::InputIterable>(irng);
+		::models_not<concepts::ForwardIterable>(irng);
+		::check_equal(strings(irng), {"let","x1","=","42",";","y","=","x1","+","1",";"});
+	}
+
 	return test_result();
 }